@@ -0,0 +1,126 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         BackgroundFreer.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Frees what a container gives up on a thread of its own in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Moved out of GenericHashTable.cpp, to share it
+ *                         with CompactHashTable.cpp
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef BACKGROUND_FREER_H
+#define BACKGROUND_FREER_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Deletes what a Table hands it on a thread of its own
+//
+// A Table owns one, so however often it is cleared there is a single
+// thread freeing behind it, and the Table's destructor waits for it.
+// The thread is only started the first time it is needed
+template <class T>
+class BackgroundFreer
+{
+    // Point to the objects waiting to be deleted
+    std::vector<T *> handed;
+
+    // Guards handed and stopping
+    std::mutex lock;
+
+    // Wakes the thread when something is handed over
+    std::condition_variable wakeUp;
+
+    // Set once the owner is going away
+    bool stopping;
+
+    // Deletes what is handed over
+    std::thread worker;
+
+    // Runs on the freeing thread
+    // Takes one object at a time off the back, so that handed never
+    // gives back the room reserve() made for the next hand()
+    void run()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+
+        while (true)
+        {
+            wakeUp.wait(guard, [this]
+                        { return stopping || !handed.empty(); });
+
+            // Only leave once everything has been deleted
+            if (handed.empty())
+                return;
+
+            T *garbage = handed.back();
+            handed.pop_back();
+
+            guard.unlock();
+            delete garbage;
+            guard.lock();
+        }
+    }
+
+public:
+    // Constructor
+    BackgroundFreer()
+    {
+        stopping = false;
+    }
+
+    // The thread points back at the BackgroundFreer, so it can't be copied
+    BackgroundFreer(const BackgroundFreer &) = delete;
+    BackgroundFreer &operator=(const BackgroundFreer &) = delete;
+
+    // Destructor
+    // Waits until everything handed over is deleted
+    ~BackgroundFreer()
+    {
+        if (worker.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopping = true;
+            }
+
+            wakeUp.notify_one();
+            worker.join();
+        }
+    }
+
+    // Starts the thread and makes room for one more object, so that
+    // the next hand() can't fail. This is the part that can throw,
+    // so call it before the Table gives anything up
+    void reserve()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        handed.reserve(handed.size() + 1);
+
+        if (!worker.joinable())
+            worker = std::thread(&BackgroundFreer::run, this);
+    }
+
+    // Takes over an object and deletes it on the freeing thread
+    // Only call this after reserve()
+    void hand(T *garbage) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            handed.push_back(garbage);
+        }
+
+        wakeUp.notify_one();
+    }
+};
+
+#endif
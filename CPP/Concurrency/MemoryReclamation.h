@@ -0,0 +1,600 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         MemoryReclamation.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Epoch based reclamation and hazard pointers in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef MEMORY_RECLAMATION_H
+#define MEMORY_RECLAMATION_H
+
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * A lock-free container can't delete a Node as soon as it is
+ * unlinked, since another thread may have read a pointer to it
+ * just before and still be looking at it. Instead the Node is
+ * retire()d, and freed once no thread can be looking at it.
+ *
+ * Both reclaimers here have the same shape, so a container can be
+ * written against either one :
+ *
+ *    Reclaimer::Guard guard;                // before reading shared pointers
+ *    Node *node = guard.protect(top);       // load a shared pointer
+ *    ...
+ *    Reclaimer::retire(node);               // once node is unlinked
+ *
+ * EpochReclaimer makes a Guard cheap and covers every pointer read
+ * under it, but a thread stuck inside a Guard holds up freeing for
+ * everyone. HazardPointers makes protect() cost a store and a fence
+ * per pointer, and a Guard covers only the one pointer it protected,
+ * but a stuck thread only keeps that one Node alive.
+ *
+ * Every container in the process shares the same two reclaimers.
+ */
+
+// Represents a Node waiting to be freed
+struct RetiredNode
+{
+    // Points to the Node
+    void *pointer;
+
+    // Frees the Node
+    void (*deleter)(void *);
+
+    // Holds the epoch the Node was retired in (EpochReclaimer only)
+    uint64_t epoch;
+};
+
+// Frees a retired Node of type T
+template <class T>
+void deleteRetired(void *pointer)
+{
+    delete (T *)pointer;
+}
+
+// Epoch based reclamation
+//
+// A global epoch counter moves up by one once every thread inside
+// a Guard has seen its current value. A thread inside a Guard
+// holds the epoch at most one step behind the one it entered in,
+// so a Node retired in epoch e can be freed once the epoch reaches
+// e + 2 : every thread that could have read it has left its Guard.
+class EpochReclaimer
+{
+    // Holds the number of retire()s between attempts to free Nodes
+    static constexpr size_t COLLECT_EVERY = 64;
+
+    // Represents a thread's part in the reclamation
+    struct ThreadRecord
+    {
+        // Holds (epoch << 1) | 1 while the thread is inside a Guard, 0 outside
+        std::atomic<uint64_t> state;
+
+        // Set while a thread owns the record
+        std::atomic<bool> inUse;
+
+        // Holds the number of Guards the thread is inside
+        int depth;
+
+        // Holds the Nodes the thread retired that are not freed yet
+        std::vector<RetiredNode> retired;
+
+        // Points to the next record
+        ThreadRecord *next;
+    };
+
+    // Represents the state shared by every thread
+    struct Domain
+    {
+        // Holds the global epoch
+        std::atomic<uint64_t> epoch;
+
+        // Points to the records of every thread that ever took part
+        std::atomic<ThreadRecord *> records;
+
+        // Hold the Nodes left behind by threads that have finished
+        std::mutex orphanLock;
+        std::vector<RetiredNode> orphans;
+
+        // Constructor
+        Domain()
+        {
+            epoch.store(1);
+            records.store(nullptr);
+        }
+
+        // Destructor
+        // Runs at exit, once no thread is left to be reading
+        ~Domain()
+        {
+            for (RetiredNode &node : orphans)
+                node.deleter(node.pointer);
+        }
+    };
+
+    // Gives the calling thread's record back when the thread finishes
+    struct RecordOwner
+    {
+        // Points to the thread's record
+        ThreadRecord *record;
+
+        // Constructor
+        RecordOwner()
+        {
+            record = nullptr;
+        }
+
+        // Destructor
+        ~RecordOwner()
+        {
+            if (record)
+                release(record);
+        }
+    };
+
+    // Returns the state shared by every thread
+    static Domain &domain()
+    {
+        static Domain instance;
+        return instance;
+    }
+
+    // Returns the calling thread's record, taking one the first time
+    static ThreadRecord *threadRecord()
+    {
+        Domain &shared = domain();
+        thread_local RecordOwner owner;
+
+        if (owner.record)
+            return owner.record;
+
+        // Reuse the record of a thread that has finished
+        for (ThreadRecord *current = shared.records.load(); current; current = current->next)
+        {
+            bool expected = false;
+
+            if (!current->inUse.load(std::memory_order_relaxed) && current->inUse.compare_exchange_strong(expected, true))
+                return owner.record = current;
+        }
+
+        // Else add a new record at the front
+        ThreadRecord *record = new ThreadRecord();
+
+        record->state.store(0);
+        record->inUse.store(true);
+        record->depth = 0;
+        record->next = shared.records.load();
+
+        while (!shared.records.compare_exchange_weak(record->next, record))
+            ;
+
+        return owner.record = record;
+    }
+
+    // Hands a finished thread's unfreed Nodes over to the other threads
+    static void release(ThreadRecord *record)
+    {
+        collect();
+
+        Domain &shared = domain();
+
+        if (!record->retired.empty())
+        {
+            std::lock_guard<std::mutex> guard(shared.orphanLock);
+            shared.orphans.insert(shared.orphans.end(), record->retired.begin(), record->retired.end());
+        }
+
+        record->retired.clear();
+        record->inUse.store(false, std::memory_order_release);
+    }
+
+    // Moves the epoch up by one, if every thread inside a Guard has seen it
+    static uint64_t tryAdvance()
+    {
+        Domain &shared = domain();
+        uint64_t epoch = shared.epoch.load();
+
+        for (ThreadRecord *current = shared.records.load(); current; current = current->next)
+        {
+            uint64_t state = current->state.load();
+
+            // A thread is still inside a Guard from an earlier epoch
+            if ((state & 1) && (state >> 1) != epoch)
+                return epoch;
+        }
+
+        shared.epoch.compare_exchange_strong(epoch, epoch + 1);
+
+        return shared.epoch.load();
+    }
+
+    // Frees the Nodes of a list retired at least two epochs ago
+    static void freeOld(std::vector<RetiredNode> &retired, uint64_t epoch)
+    {
+        size_t kept = 0;
+
+        for (RetiredNode &node : retired)
+        {
+            if (node.epoch + 2 <= epoch)
+                node.deleter(node.pointer);
+            else
+                retired[kept++] = node;
+        }
+
+        retired.resize(kept);
+    }
+
+    // Enters a Guard
+    static void enter()
+    {
+        ThreadRecord *record = threadRecord();
+
+        if (record->depth++)
+            return;
+
+        // Announce the epoch, and make sure it was still the
+        // current one once the announcement could be seen
+        std::atomic<uint64_t> &epoch = domain().epoch;
+
+        for (uint64_t seen = epoch.load();; seen = epoch.load())
+        {
+            record->state.store((seen << 1) | 1);
+
+            if (epoch.load() == seen)
+                break;
+        }
+    }
+
+    // Leaves a Guard
+    static void leave()
+    {
+        ThreadRecord *record = threadRecord();
+
+        if (!--record->depth)
+            record->state.store(0, std::memory_order_release);
+    }
+
+public:
+    // Keeps every Node read while it lives from being freed
+    // Guards nest, and copying one enters again on the calling thread
+    class Guard
+    {
+    public:
+        // Constructor
+        Guard()
+        {
+            enter();
+        }
+
+        Guard(const Guard &)
+        {
+            enter();
+        }
+
+        Guard &operator=(const Guard &)
+        {
+            return *this;
+        }
+
+        // Destructor
+        ~Guard()
+        {
+            leave();
+        }
+
+        // Loads a shared pointer
+        // Every pointer read under the Guard is already safe
+        template <class T>
+        T *protect(const std::atomic<T *> &source)
+        {
+            return source.load(std::memory_order_acquire);
+        }
+    };
+
+    // Hands an unlinked Node over to be freed once no thread can see it
+    template <class T>
+    static void retire(T *node)
+    {
+        Guard guard;
+        ThreadRecord *record = threadRecord();
+
+        record->retired.push_back({(void *)node, deleteRetired<T>, domain().epoch.load()});
+
+        if (!(record->retired.size() % COLLECT_EVERY))
+            collect();
+    }
+
+    // Frees the calling thread's retired Nodes (and those of finished
+    // threads) that no thread can be looking at any more
+    static void collect()
+    {
+        uint64_t epoch = tryAdvance();
+
+        freeOld(threadRecord()->retired, epoch);
+
+        Domain &shared = domain();
+        std::unique_lock<std::mutex> guard(shared.orphanLock, std::try_to_lock);
+
+        if (guard.owns_lock())
+            freeOld(shared.orphans, epoch);
+    }
+};
+
+// Holds the number of pointers a thread can protect at once
+const int HAZARD_SLOTS = 4;
+
+// Hazard pointers
+//
+// Each thread publishes the pointers it is about to read in its
+// hazard slots. A retired Node is only freed once no slot of any
+// thread holds it, which is checked for a batch of Nodes at a time.
+class HazardPointers
+{
+    // Holds the fewest retired Nodes that are worth a scan
+    static constexpr size_t SCAN_AT_LEAST = 64;
+
+    // Represents a thread's part in the reclamation
+    struct ThreadRecord
+    {
+        // Hold the pointers the thread is reading
+        std::atomic<void *> hazards[HAZARD_SLOTS];
+
+        // Set while a thread owns the record
+        std::atomic<bool> inUse;
+
+        // Bit i is set while hazards[i] belongs to a Guard
+        unsigned usedSlots;
+
+        // Holds the Nodes the thread retired that are not freed yet
+        std::vector<RetiredNode> retired;
+
+        // Points to the next record
+        ThreadRecord *next;
+    };
+
+    // Represents the state shared by every thread
+    struct Domain
+    {
+        // Points to the records of every thread that ever took part
+        std::atomic<ThreadRecord *> records;
+
+        // Holds the number of records
+        std::atomic<size_t> recordCount;
+
+        // Hold the Nodes left behind by threads that have finished
+        std::mutex orphanLock;
+        std::vector<RetiredNode> orphans;
+
+        // Constructor
+        Domain()
+        {
+            records.store(nullptr);
+            recordCount.store(0);
+        }
+
+        // Destructor
+        // Runs at exit, once no thread is left to be reading
+        ~Domain()
+        {
+            for (RetiredNode &node : orphans)
+                node.deleter(node.pointer);
+        }
+    };
+
+    // Gives the calling thread's record back when the thread finishes
+    struct RecordOwner
+    {
+        // Points to the thread's record
+        ThreadRecord *record;
+
+        // Constructor
+        RecordOwner()
+        {
+            record = nullptr;
+        }
+
+        // Destructor
+        ~RecordOwner()
+        {
+            if (record)
+                release(record);
+        }
+    };
+
+    // Returns the state shared by every thread
+    static Domain &domain()
+    {
+        static Domain instance;
+        return instance;
+    }
+
+    // Returns the calling thread's record, taking one the first time
+    static ThreadRecord *threadRecord()
+    {
+        Domain &shared = domain();
+        thread_local RecordOwner owner;
+
+        if (owner.record)
+            return owner.record;
+
+        // Reuse the record of a thread that has finished
+        for (ThreadRecord *current = shared.records.load(); current; current = current->next)
+        {
+            bool expected = false;
+
+            if (!current->inUse.load(std::memory_order_relaxed) && current->inUse.compare_exchange_strong(expected, true))
+                return owner.record = current;
+        }
+
+        // Else add a new record at the front
+        ThreadRecord *record = new ThreadRecord();
+
+        for (int i = 0; i < HAZARD_SLOTS; i++)
+            record->hazards[i].store(nullptr);
+
+        record->inUse.store(true);
+        record->usedSlots = 0;
+        record->next = shared.records.load();
+
+        while (!shared.records.compare_exchange_weak(record->next, record))
+            ;
+
+        shared.recordCount.fetch_add(1);
+
+        return owner.record = record;
+    }
+
+    // Hands a finished thread's unfreed Nodes over to the other threads
+    static void release(ThreadRecord *record)
+    {
+        collect();
+
+        Domain &shared = domain();
+
+        if (!record->retired.empty())
+        {
+            std::lock_guard<std::mutex> guard(shared.orphanLock);
+            shared.orphans.insert(shared.orphans.end(), record->retired.begin(), record->retired.end());
+        }
+
+        record->retired.clear();
+        record->inUse.store(false, std::memory_order_release);
+    }
+
+    // Frees the Nodes of a list that are not in a sorted list of hazards
+    static void freeUnprotected(std::vector<RetiredNode> &retired, const std::vector<void *> &hazards)
+    {
+        size_t kept = 0;
+
+        for (RetiredNode &node : retired)
+        {
+            if (std::binary_search(hazards.begin(), hazards.end(), node.pointer))
+                retired[kept++] = node;
+            else
+                node.deleter(node.pointer);
+        }
+
+        retired.resize(kept);
+    }
+
+public:
+    // Protects one pointer at a time from being freed
+    // A thread can hold upto HAZARD_SLOTS Guards at once
+    class Guard
+    {
+        // Points to the record the slot belongs to
+        ThreadRecord *record;
+
+        // Holds the slot of the Guard
+        int slot;
+
+    public:
+        // Constructor
+        // Takes a free hazard slot of the calling thread
+        Guard()
+        {
+            record = threadRecord();
+
+            for (slot = 0; slot < HAZARD_SLOTS && (record->usedSlots & (1u << slot)); slot++)
+                ;
+
+            // More Guards than slots is a bug in the caller
+            if (HAZARD_SLOTS == slot)
+                abort();
+
+            record->usedSlots |= (1u << slot);
+        }
+
+        // A slot can't be shared
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+        // Destructor
+        ~Guard()
+        {
+            record->hazards[slot].store(nullptr, std::memory_order_release);
+            record->usedSlots &= ~(1u << slot);
+        }
+
+        // Loads a shared pointer and keeps it from being freed
+        // until the Guard protects another one or goes away
+        template <class T>
+        T *protect(const std::atomic<T *> &source)
+        {
+            T *pointer = source.load(std::memory_order_relaxed);
+
+            // Publish the hazard, then make sure the pointer
+            // was still there once the hazard could be seen
+            while (true)
+            {
+                record->hazards[slot].store((void *)pointer);
+
+                T *again = source.load();
+
+                if (again == pointer)
+                    return pointer;
+
+                pointer = again;
+            }
+        }
+    };
+
+    // Hands an unlinked Node over to be freed once no Guard protects it
+    template <class T>
+    static void retire(T *node)
+    {
+        ThreadRecord *record = threadRecord();
+
+        record->retired.push_back({(void *)node, deleteRetired<T>, 0});
+
+        // Scan once the batch is big enough to pay for reading every slot
+        size_t threshold = std::max(SCAN_AT_LEAST, 2 * HAZARD_SLOTS * domain().recordCount.load(std::memory_order_relaxed));
+
+        if (record->retired.size() >= threshold)
+            collect();
+    }
+
+    // Frees the calling thread's retired Nodes (and those of finished
+    // threads) that no Guard protects
+    static void collect()
+    {
+        Domain &shared = domain();
+        std::vector<void *> hazards;
+
+        for (ThreadRecord *current = shared.records.load(); current; current = current->next)
+        {
+            for (int i = 0; i < HAZARD_SLOTS; i++)
+            {
+                void *pointer = current->hazards[i].load();
+
+                if (pointer)
+                    hazards.push_back(pointer);
+            }
+        }
+
+        std::sort(hazards.begin(), hazards.end());
+
+        freeUnprotected(threadRecord()->retired, hazards);
+
+        std::unique_lock<std::mutex> guard(shared.orphanLock, std::try_to_lock);
+
+        if (guard.owns_lock())
+            freeUnprotected(shared.orphans, hazards);
+    }
+};
+
+#endif
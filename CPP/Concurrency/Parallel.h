@@ -0,0 +1,126 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         Parallel.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Parallel loops over chunks of a container in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Runs parallel loops on a work-stealing ThreadPool
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.h"
+
+/**
+ * A container splits itself into chunks it can walk independently
+ * (a range of buckets, or the Nodes between two marked ones), and
+ * hands parallelFor() the number of chunks and a function that
+ * walks one :
+ *
+ *    parallelFor(chunks, [&](int chunk) { ... });
+ *
+ * The loop runs on one ThreadPool shared by every container. The
+ * range of chunks is split in halves, and the halves handed to the
+ * pool, until one chunk is left to run. Workers that run out steal
+ * the biggest halves left, so a thread that gets cheap chunks (empty
+ * buckets, short chains) just ends up with more of them instead of
+ * idling while another works through a fixed share. Containers cut
+ * many more chunks than there are threads for that reason.
+ *
+ * The container must not change while a parallel loop runs over it.
+ */
+
+// Returns the number of threads a parallel loop runs on
+inline int parallelThreads()
+{
+    int threads = std::thread::hardware_concurrency();
+
+    return threads > 0 ? threads : 1;
+}
+
+// Returns the ThreadPool parallel loops run on
+// The thread that starts a loop works on it too, so the pool
+// has one Worker less than there are threads to run on
+inline ThreadPool &parallelPool()
+{
+    static ThreadPool pool(parallelThreads() - 1);
+    return pool;
+}
+
+// Runs work(chunk) for every chunk in [first, last)
+// Hands the upper half of the range to the pool until a single
+// chunk is left, which it runs and counts off in left
+template <class Function>
+void runChunks(ThreadPool &pool, Function &work, std::atomic<int> &left, int first, int last)
+{
+    while (last - first > 1)
+    {
+        int middle = first + (last - first) / 2;
+
+        pool.submit([&pool, &work, &left, middle, last]
+                    { runChunks(pool, work, left, middle, last); });
+        last = middle;
+    }
+
+    work(first);
+
+    // Nothing of the loop may be touched after this
+    left.fetch_sub(1, std::memory_order_release);
+}
+
+// Runs work(chunk) for every chunk in [0, chunks)
+// The calling thread runs chunks (or other Tasks) until they are done
+template <class Function>
+void parallelFor(int chunks, Function work)
+{
+    if (chunks <= 0)
+        return;
+
+    ThreadPool &pool = parallelPool();
+    std::atomic<int> left(chunks);
+
+    runChunks(pool, work, left, 0, chunks);
+
+    pool.runUntil([&]
+                  { return left.load(std::memory_order_acquire) == 0; });
+}
+
+// Returns the combine() of reduceChunk(chunk) over every chunk
+//
+// Chunk results are combined in chunk order, after every chunk
+// is done, so the result doesn't depend on which thread ran which
+// chunk. combine() must be associative and identity must leave a
+// value unchanged
+template <class T, class Reduce, class Combine>
+T parallelReduce(int chunks, T identity, Reduce reduceChunk, Combine combine)
+{
+    // Keeps each chunk's result on a cache line of its own
+    struct alignas(64) ChunkResult
+    {
+        T value;
+    };
+
+    std::vector<ChunkResult> results(chunks, ChunkResult{identity});
+
+    parallelFor(chunks, [&](int chunk)
+                { results[chunk].value = reduceChunk(chunk); });
+
+    for (auto &result : results)
+        identity = combine(identity, result.value);
+
+    return identity;
+}
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         ThreadPool.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Work-stealing deque and thread pool benchmarks in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <chrono>
+
+#include "ThreadPool.h"
+
+using namespace std;
+
+// Returns the microseconds since start
+long elapsed(chrono::steady_clock::time_point start)
+{
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+}
+
+// Pushes and pops values on one thread, in bursts of 64
+// against a WorkStealingDeque and a locked deque
+void ownerThroughput(int operations)
+{
+    WorkStealingDeque<long> stealing;
+    long sum = 0, value;
+
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < operations; i += 64)
+    {
+        for (int j = 0; j < 64; j++)
+            stealing.push(i + j);
+
+        while (stealing.pop(value))
+            sum += value;
+    }
+
+    long lockFree = elapsed(start);
+
+    deque<long> locked;
+    mutex lock;
+
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < operations; i += 64)
+    {
+        for (int j = 0; j < 64; j++)
+        {
+            lock_guard<mutex> guard(lock);
+            locked.push_back(i + j);
+        }
+
+        while (true)
+        {
+            lock_guard<mutex> guard(lock);
+
+            if (locked.empty())
+                break;
+
+            sum -= locked.back();
+            locked.pop_back();
+        }
+    }
+
+    cout << "Owner push/pop : " << lockFree << " us, locked deque : " << elapsed(start)
+         << " us (" << (sum == 0) << ")" << endl;
+}
+
+// Lets thieves steal while the owner pushes and pops
+// Every value must be taken exactly once
+void stealThroughput(int thieves, int values)
+{
+    WorkStealingDeque<long> tasks;
+    atomic<long> stolenSum(0), stolen(0);
+    atomic<bool> done(false);
+
+    vector<thread> threads;
+
+    auto start = chrono::steady_clock::now();
+
+    for (int t = 0; t < thieves; t++)
+    {
+        threads.push_back(thread([&]
+                                 {
+            long value, sum = 0, count = 0;
+
+            while (!done.load() || tasks.size())
+            {
+                if (tasks.steal(value))
+                {
+                    sum += value;
+                    count++;
+                }
+            }
+
+            stolenSum += sum;
+            stolen += count; }));
+    }
+
+    long ownSum = 0, value;
+
+    for (int i = 1; i <= values; i++)
+    {
+        tasks.push(i);
+
+        // Keep some for ourselves
+        if (i % 4 == 0 && tasks.pop(value))
+            ownSum += value;
+    }
+
+    while (tasks.pop(value))
+        ownSum += value;
+
+    done.store(true);
+
+    for (auto &thief : threads)
+        thief.join();
+
+    long expected = (long)values * (values + 1) / 2;
+
+    cout << "Steals : " << stolen.load() << " of " << values << " in " << elapsed(start)
+         << " us (" << (ownSum + stolenSum.load() == expected) << ")" << endl;
+}
+
+// Spawns a binary tree of Tasks depth deep, from inside the pool
+void spawnTree(ThreadPool &pool, atomic<long> &ran, int depth)
+{
+    ran++;
+
+    if (depth > 0)
+    {
+        pool.submit([&pool, &ran, depth]
+                    { spawnTree(pool, ran, depth - 1); });
+        pool.submit([&pool, &ran, depth]
+                    { spawnTree(pool, ran, depth - 1); });
+    }
+}
+
+// Runs tasks empty Tasks submitted from outside the pool,
+// then a tree of Tasks submitted by Tasks
+void taskThroughput(int threads, int tasks, int depth)
+{
+    atomic<long> ran(0);
+    ThreadPool pool(threads);
+
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < tasks; i++)
+        pool.submit([&ran]
+                    { ran++; });
+
+    pool.runUntil([&]
+                  { return ran.load() == tasks; });
+
+    long outside = elapsed(start);
+
+    ran.store(0);
+    long nodes = (2L << depth) - 1;
+
+    start = chrono::steady_clock::now();
+
+    pool.submit([&pool, &ran, depth]
+                { spawnTree(pool, ran, depth); });
+    pool.runUntil([&]
+                  { return ran.load() == nodes; });
+
+    long inside = elapsed(start);
+
+    cout << "Workers : " << threads << ", " << tasks << " Tasks from outside in " << outside << " us, "
+         << nodes << " from Tasks in " << inside << " us ("
+         << (long)(nodes / (inside / 1e6 + 1e-9)) << " Tasks/s)" << endl;
+}
+
+int main()
+{
+    // Create a new deque
+    WorkStealingDeque<int> deque(2);
+
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+
+    int value;
+
+    // The owner takes the newest, a thief the oldest
+    if (deque.pop(value))
+        cout << value << " ";
+    if (deque.steal(value))
+        cout << value << " ";
+
+    cout << deque.size() << endl;
+
+    // Run some Tasks on a pool
+    atomic<int> sum(0);
+    ThreadPool pool(2);
+
+    for (int i = 1; i <= 100; i++)
+        pool.submit([&sum, i]
+                    { sum += i; });
+
+    pool.runUntil([&]
+                  { return sum.load() == 5050; });
+    cout << sum.load() << endl;
+
+    ownerThroughput(10000000);
+    stealThroughput(3, 1000000);
+
+    taskThroughput(1, 200000, 17);
+    taskThroughput(4, 200000, 17);
+
+    return 0;
+}
@@ -0,0 +1,488 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         ThreadPool.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Work-stealing deque and thread pool in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+
+/**
+ * Every Worker of a ThreadPool owns a WorkStealingDeque. A Task
+ * submitted from a Worker goes on the Bottom of its own deque, and
+ * the Worker pops its newest Task first, which is the one whose data
+ * is still in its cache. A Worker that runs dry steals the oldest
+ * Task of another (from the Top), which for split up work is the
+ * biggest piece left, so thieves take few, large Tasks and rarely
+ * touch the same end as the owner.
+ *
+ * Tasks submitted from other threads wait in a shared queue, which
+ * Workers take from before stealing.
+ *
+ *    ThreadPool pool(4);
+ *    pool.submit([&] { ... });
+ *    pool.runUntil([&] { return done.load(); });   // helps meanwhile
+ */
+
+// Represents a Chase-Lev work-stealing deque
+//
+// One thread, the owner, push()es and pop()s at the Bottom; any
+// thread may steal() from the Top. The owner only races thieves
+// for the last value, with a compare-exchange on the Top, so neither
+// end ever takes a lock. Values live in a circular array that doubles
+// when it is full.
+//
+// T must be trivially copyable (a ThreadPool keeps Task pointers)
+template <class T>
+class WorkStealingDeque
+{
+    // Represents the circular array of values
+    struct Array
+    {
+        // Holds the number of slots (a power of 2)
+        int64_t capacity;
+
+        // Holds the slots
+        std::atomic<T> *slots;
+
+        // Constructor
+        Array(int64_t capacity)
+        {
+            this->capacity = capacity;
+            slots = new std::atomic<T>[capacity];
+        }
+
+        // Destructor
+        ~Array()
+        {
+            delete[] slots;
+        }
+
+        // Returns the value at index i
+        T get(int64_t i)
+        {
+            return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        // Stores a value at index i
+        void put(int64_t i, T value)
+        {
+            slots[i & (capacity - 1)].store(value, std::memory_order_relaxed);
+        }
+
+        // Returns an Array twice as big holding the values in [top, bottom)
+        Array *grow(int64_t top, int64_t bottom)
+        {
+            Array *bigger = new Array(capacity * 2);
+
+            for (int64_t i = top; i < bottom; i++)
+                bigger->put(i, get(i));
+
+            return bigger;
+        }
+    };
+
+    // Holds the index thieves steal at
+    alignas(64) std::atomic<int64_t> top;
+
+    // Holds the index the owner pushes at
+    alignas(64) std::atomic<int64_t> bottom;
+
+    // Points to the current Array
+    std::atomic<Array *> array;
+
+    // Holds the Arrays grown out of
+    // A thief may still be reading one, so they are kept until
+    // the deque goes away (they add up to less than the current one)
+    std::vector<Array *> retired;
+
+public:
+    // Constructor
+    // capacity must be a power of 2
+    WorkStealingDeque(int64_t capacity = 64)
+    {
+        top.store(0);
+        bottom.store(0);
+        array.store(new Array(capacity));
+    }
+
+    // Threads may still be stealing, so the deque can't be copied
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+    // Destructor
+    // No other thread may be using the deque by now
+    ~WorkStealingDeque()
+    {
+        delete array.load();
+
+        for (Array *old : retired)
+            delete old;
+    }
+
+    // Adds a value at the Bottom
+    // Only the owner may push()
+    void push(T value)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Array *current = array.load(std::memory_order_relaxed);
+
+        // The Array is full
+        if (b - t > current->capacity - 1)
+        {
+            retired.push_back(current);
+
+            current = current->grow(t, b);
+            array.store(current, std::memory_order_release);
+        }
+
+        current->put(b, value);
+
+        // A thief that sees the new Bottom must see the value too
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Removes the value at the Bottom (the newest)
+    // Only the owner may pop()
+    bool pop(T &value)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Array *current = array.load(std::memory_order_relaxed);
+
+        // Claim the Bottom value before looking at the Top,
+        // so that a thief reading the Top after this sees the claim
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int64_t t = top.load(std::memory_order_relaxed);
+
+        // The deque was empty
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = current->get(b);
+
+        // This is the last value, so a thief may be after it too
+        // Whoever moves the Top past it gets it
+        if (t == b)
+        {
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+
+            return won;
+        }
+
+        return true;
+    }
+
+    // Removes the value at the Top (the oldest)
+    // Returns false if the deque is empty, or another thread
+    // took the value first
+    bool steal(T &value)
+    {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+
+        // The deque is empty
+        if (t >= b)
+            return false;
+
+        // The value must be read before the Top moves past it,
+        // after which the owner may write over its slot
+        value = array.load(std::memory_order_acquire)->get(t);
+
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // Returns the number of values
+    // (only a hint while other threads use the deque)
+    int64_t size()
+    {
+        int64_t count = bottom.load(std::memory_order_relaxed) - top.load(std::memory_order_relaxed);
+
+        return count > 0 ? count : 0;
+    }
+};
+
+// Represents a pool of threads that run Tasks
+//
+// Each Worker takes from its own WorkStealingDeque first, then from
+// the shared queue, then steals from the other Workers. A Worker
+// that finds nothing anywhere sleeps until a Task is submitted.
+class ThreadPool
+{
+    // Represents a function waiting to run
+    struct Task
+    {
+        std::function<void()> run;
+    };
+
+    // Represents a thread of the pool
+    struct Worker
+    {
+        // Holds the Tasks submitted from this Worker
+        WorkStealingDeque<Task *> tasks;
+
+        // The Worker's thread
+        std::thread thread;
+    };
+
+    // Tells a thread which pool it belongs to, if any
+    struct Membership
+    {
+        ThreadPool *pool;
+        Worker *worker;
+    };
+
+    // Point to the Workers
+    std::vector<Worker *> workers;
+
+    // Hold the Tasks submitted from threads outside the pool
+    std::mutex injectedLock;
+    std::deque<Task *> injected;
+
+    // Holds the number of Tasks submitted and not taken yet
+    std::atomic<long> pending;
+
+    // Holds the number of Workers asleep
+    std::atomic<int> sleeping;
+
+    // Let Workers sleep until there is a Task
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+
+    // Set once the pool is going away
+    bool stopping;
+
+    // Returns the calling thread's Membership
+    static Membership &membership()
+    {
+        thread_local Membership member = {nullptr, nullptr};
+        return member;
+    }
+
+    // Returns the calling thread's Worker in this pool
+    // (nullptr for threads outside the pool)
+    Worker *self()
+    {
+        Membership &member = membership();
+
+        return member.pool == this ? member.worker : nullptr;
+    }
+
+    // Returns a Task to run, or nullptr if none could be found
+    Task *take(Worker *worker)
+    {
+        Task *task = nullptr;
+
+        // Newest Task of our own first
+        if (worker && worker->tasks.pop(task))
+        {
+            pending.fetch_sub(1);
+            return task;
+        }
+
+        // Nothing was submitted anywhere
+        if (pending.load(std::memory_order_relaxed) <= 0)
+            return nullptr;
+
+        // Then the oldest Task submitted from outside
+        {
+            std::lock_guard<std::mutex> guard(injectedLock);
+
+            if (!injected.empty())
+            {
+                task = injected.front();
+                injected.pop_front();
+
+                pending.fetch_sub(1);
+                return task;
+            }
+        }
+
+        // Then steal, starting past ourselves so that
+        // thieves don't all go after the same Worker
+        size_t start = 0;
+
+        for (size_t i = 0; i < workers.size(); i++)
+        {
+            if (workers[i] == worker)
+                start = i + 1;
+        }
+
+        for (size_t i = 0; i < workers.size(); i++)
+        {
+            Worker *victim = workers[(start + i) % workers.size()];
+
+            if (victim != worker && victim->tasks.steal(task))
+            {
+                pending.fetch_sub(1);
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Runs Tasks until the pool goes away
+    void work(Worker *worker)
+    {
+        membership() = {this, worker};
+
+        while (true)
+        {
+            Task *task = take(worker);
+
+            if (task)
+            {
+                task->run();
+                delete task;
+
+                continue;
+            }
+
+            std::this_thread::yield();
+
+            // Sleep until a Task is submitted
+            // sleeping goes up before pending is checked, and submit()
+            // raises pending before checking sleeping, so either this
+            // Worker sees the Task or submit() sees it asleep
+            std::unique_lock<std::mutex> lock(sleepLock);
+
+            sleeping.fetch_add(1);
+            wakeUp.wait(lock, [&]
+                        { return pending.load() > 0 || stopping; });
+            sleeping.fetch_sub(1);
+
+            // Only leave once every Task has been run
+            if (stopping && pending.load() <= 0)
+                return;
+        }
+    }
+
+public:
+    // Constructor
+    // Starts threads Workers
+    ThreadPool(int threads)
+    {
+        pending.store(0);
+        sleeping.store(0);
+        stopping = false;
+
+        // Every deque must exist before any Worker steals
+        for (int i = 0; i < threads; i++)
+            workers.push_back(new Worker());
+
+        for (Worker *worker : workers)
+            worker->thread = std::thread(&ThreadPool::work, this, worker);
+    }
+
+    // Workers point back at the pool, so it can't be copied
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Destructor
+    // Runs every Task left, then stops the Workers
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            stopping = true;
+        }
+
+        wakeUp.notify_all();
+
+        for (Worker *worker : workers)
+        {
+            worker->thread.join();
+            delete worker;
+        }
+
+        // Only left if the pool has no Workers
+        while (!injected.empty())
+        {
+            Task *task = injected.front();
+            injected.pop_front();
+
+            task->run();
+            delete task;
+        }
+    }
+
+    // Adds a Task to run on the pool
+    void submit(std::function<void()> function)
+    {
+        Task *task = new Task{std::move(function)};
+        Worker *worker = self();
+
+        if (worker)
+            worker->tasks.push(task);
+        else
+        {
+            std::lock_guard<std::mutex> guard(injectedLock);
+            injected.push_back(task);
+        }
+
+        pending.fetch_add(1);
+
+        if (sleeping.load())
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            wakeUp.notify_one();
+        }
+    }
+
+    // Runs Tasks on the calling thread until done() returns true
+    // A thread waiting on Tasks helps run them instead of blocking,
+    // so a Task may wait on Tasks it submitted without tying up a Worker
+    template <class Done>
+    void runUntil(Done done)
+    {
+        Worker *worker = self();
+
+        while (!done())
+        {
+            Task *task = take(worker);
+
+            if (task)
+            {
+                task->run();
+                delete task;
+            }
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    // Returns the number of Workers
+    int size()
+    {
+        return workers.size();
+    }
+};
+
+#endif
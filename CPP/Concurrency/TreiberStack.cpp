@@ -0,0 +1,178 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         TreiberStack.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Lock-free (Treiber) Stack in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+
+#include "MemoryReclamation.h"
+
+using namespace std;
+
+// Node represents a value in the Stack
+template <class V>
+struct Node
+{
+    // Holds the value of the Node
+    V value;
+
+    // Points to the Node below
+    Node<V> *next;
+
+    // Constructor
+    Node(V v)
+    {
+        this->value = v;
+        this->next = nullptr;
+    }
+};
+
+// Represents a lock-free Stack
+//
+// push() and pop() swing the Top with a compare-exchange.
+// A popped Node is retire()d instead of deleted, so that a thread
+// still reading its next pointer doesn't read freed memory, and
+// its address can't come back as a new Node while another thread
+// is about to compare-exchange against it (the "ABA problem")
+template <class V, class Reclaimer = EpochReclaimer>
+class TreiberStack
+{
+    // Points to the Top
+    atomic<Node<V> *> top;
+
+public:
+    // Constructor
+    TreiberStack()
+    {
+        top.store(nullptr);
+    }
+
+    // Threads may still be using the Stack, so it can't be copied
+    TreiberStack(const TreiberStack &) = delete;
+    TreiberStack &operator=(const TreiberStack &) = delete;
+
+    // Destructor
+    // No other thread may be using the Stack by now
+    ~TreiberStack()
+    {
+        clear();
+    }
+
+    // Adds a value at the Top
+    void push(V value)
+    {
+        Node<V> *newNode = new Node<V>(value);
+        newNode->next = top.load(memory_order_relaxed);
+
+        while (!top.compare_exchange_weak(newNode->next, newNode, memory_order_release, memory_order_relaxed))
+            ;
+    }
+
+    // Removes the value at the Top
+    bool pop(V &value)
+    {
+        typename Reclaimer::Guard guard;
+
+        while (true)
+        {
+            Node<V> *current = guard.protect(top);
+
+            // The Stack is empty
+            if (!current)
+                return false;
+
+            // current can't be freed while the Guard protects it
+            if (top.compare_exchange_weak(current, current->next, memory_order_acquire, memory_order_relaxed))
+            {
+                value = current->value;
+                Reclaimer::retire(current);
+
+                return true;
+            }
+        }
+    }
+
+    // Clears the entire Stack
+    // No other thread may be using the Stack
+    int clear()
+    {
+        int counter = 0;
+
+        for (Node<V> *current = top.exchange(nullptr), *next; current; current = next)
+        {
+            next = current->next;
+
+            delete current;
+            counter++;
+        }
+
+        return counter;
+    }
+};
+
+// Lets threads push and pop from one Stack at once
+// Returns the time taken, in milliseconds
+template <class Reclaimer>
+long churn(int threads, int operations)
+{
+    TreiberStack<int, Reclaimer> stack;
+    vector<thread> workers;
+
+    auto start = chrono::steady_clock::now();
+
+    for (int t = 0; t < threads; t++)
+    {
+        workers.push_back(thread([&stack, operations]
+                                 {
+            int value;
+
+            for (int i = 0; i < operations; i++)
+            {
+                stack.push(i);
+                stack.pop(value);
+            } }));
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    // Create a new Stack
+    TreiberStack<string> stack;
+
+    stack.push("Dennis");
+    stack.push("Bjarne");
+    stack.push("Stepanov");
+
+    string result;
+    if (stack.pop(result))
+        cout << result << endl;
+
+    cout << stack.clear() << endl;
+
+    // Compare the cost of the two reclaimers
+    // Every pop() retires a Node, so this is all churn
+    cout << "Epochs : " << churn<EpochReclaimer>(4, 200000) << " ms" << endl;
+    cout << "Hazard pointers : " << churn<HazardPointers>(4, 200000) << " ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,652 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         CompactHashTable.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Hash Table of slab allocated, index linked Entries in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Copy assignment copies, then swaps
+ * 2026-October-19	[AG] : Moved out of GenericHashTable.cpp
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <chrono>
+
+#include "../Concurrency/BackgroundFreer.h"
+#include "../Serialization/DumpWriter.h"
+
+using namespace std;
+
+// Represents an Entry of a CompactHashTable
+//
+// The field that needs the stricter alignment goes first,
+// so that no padding is needed between the key and the value,
+// and the 32 bit index of the next Entry packs in after them
+template <class K, class V, bool ValueFirst = (alignof(V) > alignof(K))>
+struct CompactEntry
+{
+    // Holds the key of the Entry
+    K key;
+
+    // Holds the value of the Entry
+    V value;
+
+    // Holds the index + 1 of the Collision Entry (0 if there is none)
+    uint32_t collisionEntry;
+};
+
+template <class K, class V>
+struct CompactEntry<K, V, true>
+{
+    // Holds the value of the Entry
+    V value;
+
+    // Holds the key of the Entry
+    K key;
+
+    // Holds the index + 1 of the Collision Entry (0 if there is none)
+    uint32_t collisionEntry;
+};
+
+/**
+ * A Hash Table for many small Entries.
+ *
+ * HashTable allocates every Entry on its own, so each one pays
+ * for an 8 byte pointer and the allocator's header on top of the
+ * key and value. Here Entries are carved out of big slabs, and
+ * link to each other (and the "buckets" to them) by 32 bit index
+ * instead of by pointer : an int to int Entry takes 12 bytes,
+ * plus 2 to 4 bytes of "bucket" per Entry.
+ *
+ * The Table doubles its "buckets" once it holds twice as many
+ * Entries as "buckets", and can hold up to 2^32 - 1 Entries.
+ */
+template <class K, class V>
+class CompactHashTable
+{
+    // Holds the number of Entries in a slab (a power of two)
+    static const uint32_t SLAB_ENTRIES = 4096;
+    static const uint32_t SLAB_SHIFT = 12;
+
+    // Holds the index + 1 of the first Entry of each "bucket"
+    vector<uint32_t> table;
+
+    // Point to the slabs of Entries
+    vector<CompactEntry<K, V> *> slabs;
+
+    // Holds the number of slab Entries ever handed out
+    uint32_t used;
+
+    // Holds the index + 1 of the first removed Entry, which
+    // link to each other through collisionEntry
+    uint32_t freeEntries;
+
+    // Holds the number of Entries in the Table
+    uint32_t count;
+
+    // Holds the buffer of dump()
+    string dumpBuffer;
+
+    // Holds the slabs clearAsync() took from the Table
+    struct Cleared
+    {
+        vector<CompactEntry<K, V> *> slabs;
+
+        // Destructor
+        // Runs on the BackgroundFreer's thread
+        ~Cleared()
+        {
+            for (auto slab : slabs)
+                delete[] slab;
+        }
+    };
+
+    // Frees what clearAsync() takes from the Table
+    BackgroundFreer<Cleared> freer;
+
+    // Returns the Entry at index + 1
+    CompactEntry<K, V> &at(uint32_t link)
+    {
+        uint32_t index = link - 1;
+
+        return slabs[index >> SLAB_SHIFT][index & (SLAB_ENTRIES - 1)];
+    }
+
+    // Returns the hash of the Key
+    size_t getHash(const K &key)
+    {
+        return std::hash<K>()(key) % table.size();
+    }
+
+    // Returns the index + 1 of an unused Entry
+    uint32_t allocate()
+    {
+        // Reuse a removed Entry first
+        if (freeEntries)
+        {
+            uint32_t link = freeEntries;
+            freeEntries = at(link).collisionEntry;
+
+            return link;
+        }
+
+        // All slabs are full, add another
+        if (used == slabs.size() * SLAB_ENTRIES)
+            slabs.push_back(new CompactEntry<K, V>[SLAB_ENTRIES]);
+
+        return ++used;
+    }
+
+    // Doubles the number of "buckets" and moves every Entry over
+    void grow()
+    {
+        vector<uint32_t> old(table.size() * 2 + 1, 0);
+        old.swap(table);
+
+        // Holds the last Entry of each new "bucket", Entries are added
+        // at the end so that newer Entries stay in front of older ones
+        vector<uint32_t> last(table.size(), 0);
+
+        for (uint32_t first : old)
+        {
+            for (uint32_t link = first, next; link; link = next)
+            {
+                CompactEntry<K, V> &entry = at(link);
+                next = entry.collisionEntry;
+
+                size_t hash = getHash(entry.key);
+                entry.collisionEntry = 0;
+
+                if (last[hash])
+                    at(last[hash]).collisionEntry = link;
+                else
+                    table[hash] = link;
+
+                last[hash] = link;
+            }
+        }
+    }
+
+    // Gives the Table its own copy of another Table's slabs
+    // Trivially copyable Entries are copied a slab at a time
+    // Each slab is kept before it is filled in, so that the
+    // destructor frees it if copying an Entry throws
+    void copySlabs(const CompactHashTable &other)
+    {
+        slabs.reserve(other.slabs.size());
+
+        for (size_t i = 0; i < other.slabs.size(); i++)
+        {
+            CompactEntry<K, V> *slab = new CompactEntry<K, V>[SLAB_ENTRIES];
+            slabs.push_back(slab);
+
+            // Only the Entries handed out so far need copying
+            size_t entries = min((size_t)SLAB_ENTRIES, other.used - i * SLAB_ENTRIES);
+
+            if constexpr (is_trivially_copyable<CompactEntry<K, V>>::value)
+                memcpy((void *)slab, other.slabs[i], entries * sizeof(CompactEntry<K, V>));
+            else
+                std::copy(other.slabs[i], other.slabs[i] + entries, slab);
+        }
+    }
+
+    // Returns the index + 1 of the Entry holding key (0 if there is none)
+    uint32_t findEntry(const K &key)
+    {
+        // A moved from Table has no "buckets"
+        if (table.empty())
+            return 0;
+
+        for (uint32_t link = table[getHash(key)]; link; link = at(link).collisionEntry)
+        {
+            if (key == at(link).key)
+                return link;
+        }
+
+        return 0;
+    }
+
+    // Adds a new Entry at the front of its "bucket"
+    // Returns false if the Table already holds 2^32 - 1 Entries
+    bool addEntry(K key, V value)
+    {
+        if (UINT32_MAX == count)
+            return false;
+
+        // Keep the Collision Lists short
+        if (count >= table.size() * 2)
+            grow();
+
+        size_t hash = getHash(key);
+        uint32_t link = allocate();
+        CompactEntry<K, V> &newEntry = at(link);
+
+        newEntry.key = std::move(key);
+        newEntry.value = std::move(value);
+
+        // Add newEntry at the front of the Collision List
+        newEntry.collisionEntry = table[hash];
+        table[hash] = link;
+
+        count++;
+        return true;
+    }
+
+public:
+    // Constructor
+    CompactHashTable(int initialSize = 11)
+    {
+        table.assign(initialSize, 0);
+
+        used = 0;
+        freeEntries = 0;
+        count = 0;
+    }
+
+    // Copy Constructor
+    // Entries link by index, so the copies need no fixing up
+    // Starts out as an empty Table, so that the destructor frees
+    // the slabs already copied if copying an Entry throws
+    CompactHashTable(const CompactHashTable &other) : CompactHashTable(0)
+    {
+        copySlabs(other);
+
+        table = other.table;
+        used = other.used;
+        freeEntries = other.freeEntries;
+        count = other.count;
+    }
+
+    // Move Constructor
+    // Takes other's "buckets" and slabs in O(1)
+    // other is left empty, without "buckets" until its next put()
+    // (which grow() from none)
+    CompactHashTable(CompactHashTable &&other) noexcept
+    {
+        used = 0;
+        freeEntries = 0;
+        count = 0;
+
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the Table moved from), so a copy
+    // that throws leaves this Table as it was. Our slabs go to other,
+    // to be freed with it
+    CompactHashTable &operator=(CompactHashTable other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~CompactHashTable()
+    {
+        for (auto slab : slabs)
+            delete[] slab;
+    }
+
+    // Trades Entries with another Table
+    void swap(CompactHashTable &other) noexcept
+    {
+        table.swap(other.table);
+        slabs.swap(other.slabs);
+        std::swap(used, other.used);
+        std::swap(freeEntries, other.freeEntries);
+        std::swap(count, other.count);
+    }
+
+    // Adds a value to the Hash Table
+    // Replaces the value of a key that is already there, like HashTable
+    // Returns false if the Table already holds 2^32 - 1 Entries
+    bool put(K key, V value)
+    {
+        uint32_t link = findEntry(key);
+
+        // Key found, replace its value
+        if (link)
+        {
+            at(link).value = std::move(value);
+            return true;
+        }
+
+        return addEntry(std::move(key), std::move(value));
+    }
+
+    // Adds a key-value pair, or replaces the value of an existing key
+    // Returns true if the key was new (and there was room for it)
+    bool insertOrAssign(K key, V value)
+    {
+        uint32_t link = findEntry(key);
+
+        // Key found, replace its value
+        if (link)
+        {
+            at(link).value = std::move(value);
+            return false;
+        }
+
+        return addEntry(std::move(key), std::move(value));
+    }
+
+    // Adds a key with a value made from args, only if the key is new
+    // Nothing is made if the key is already there
+    // Returns true if the key was new (and there was room for it)
+    template <class... Args>
+    bool tryEmplace(K key, Args &&...args)
+    {
+        // Key found, leave it as it is
+        if (findEntry(key))
+            return false;
+
+        return addEntry(std::move(key), V(std::forward<Args>(args)...));
+    }
+
+    // Calls change(value) on the value of a key, in place
+    // Returns false if there is no such key
+    template <class Function>
+    bool update(const K &key, Function change)
+    {
+        uint32_t link = findEntry(key);
+
+        // No such key in the Table
+        if (!link)
+            return false;
+
+        change(at(link).value);
+        return true;
+    }
+
+    // Gets the value of a key from the Hash Table
+    bool get(K key, V &value)
+    {
+        uint32_t link = findEntry(key);
+
+        // Key found
+        if (link)
+        {
+            value = at(link).value;
+            return true;
+        }
+
+        // No such key in the Table
+        return false;
+    }
+
+    // Removes a key-value pair from the Table
+    bool remove(K key)
+    {
+        // A moved from Table has no "buckets", nor Entries
+        if (table.empty())
+            return false;
+
+        // Points to the link leading to the current Entry
+        uint32_t *previous = &table[getHash(key)];
+
+        for (uint32_t link = *previous; link; link = *previous)
+        {
+            CompactEntry<K, V> &current = at(link);
+
+            // Key found
+            if (key == current.key)
+            {
+                *previous = current.collisionEntry;
+
+                // Let go of what the key and value hold,
+                // and keep the Entry for the next put()
+                current.key = K();
+                current.value = V();
+                current.collisionEntry = freeEntries;
+                freeEntries = link;
+
+                count--;
+                return true;
+            }
+
+            previous = &current.collisionEntry;
+        }
+
+        // No such key in the Table
+        return false;
+    }
+
+    // Returns the number of Entries in the Table
+    uint32_t size()
+    {
+        return count;
+    }
+
+    // Clears the entire Table
+    int clear()
+    {
+        int counter = count;
+
+        // Whole slabs go at once, not one Entry at a time
+        for (auto slab : slabs)
+            delete[] slab;
+
+        slabs.clear();
+        table.assign(table.size(), 0);
+
+        used = 0;
+        freeEntries = 0;
+        count = 0;
+
+        return counter;
+    }
+
+    // Clears the entire Table, leaving the freeing to a background thread
+    // Returns the number of Entries handed over
+    int clearAsync()
+    {
+        int counter = count;
+
+        // Everything that can fail comes first,
+        // before the Table gives anything up
+        freer.reserve();
+        Cleared *cleared = new Cleared();
+
+        // Take the slabs, the Table starts again without any
+        cleared->slabs.swap(slabs);
+        freer.hand(cleared);
+
+        table.assign(table.size(), 0);
+
+        used = 0;
+        freeEntries = 0;
+        count = 0;
+
+        return counter;
+    }
+
+    // Returns the bytes held by the Table
+    // (not counting memory the keys and values hold themselves)
+    size_t memoryUsage()
+    {
+        return sizeof(*this) +
+               table.capacity() * sizeof(uint32_t) +
+               slabs.capacity() * sizeof(CompactEntry<K, V> *) +
+               slabs.size() * SLAB_ENTRIES * sizeof(CompactEntry<K, V>);
+    }
+
+    // Writes every Entry to a stream, "bucket" by "bucket"
+    bool dump(ostream &out, DumpFormat format = DUMP_TEXT)
+    {
+        DumpWriter writer(out, format, dumpBuffer);
+
+        for (size_t i = 0; i < table.size(); i++)
+        {
+            writer.beginBucket(i);
+
+            for (uint32_t link = table[i]; link; link = at(link).collisionEntry)
+                writer.entry(at(link).key, at(link).value, at(link).collisionEntry);
+
+            writer.endBucket();
+        }
+
+        return writer.finish();
+    }
+
+    // Prints the entire Hash Table
+    void printTable()
+    {
+        dump(cout);
+    }
+};
+
+// A 16 byte value
+struct Span
+{
+    long start;
+    long length;
+};
+
+// Times copying a CompactHashTable of n Entries, against
+// building the copy by putting every Entry again
+template <class V>
+void copyAgainstPuts(int n)
+{
+    CompactHashTable<int, V> original;
+    V value;
+
+    memset((void *)&value, 0, sizeof(value));
+
+    for (int i = 0; i < n; i++)
+        original.put(i, value);
+
+    auto start = chrono::steady_clock::now();
+    CompactHashTable<int, V> copy(original);
+    auto copying = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    CompactHashTable<int, V> rebuilt;
+
+    for (int i = 0; i < n; i++)
+    {
+        original.get(i, value);
+        rebuilt.put(i, value);
+    }
+
+    auto putting = chrono::steady_clock::now() - start;
+
+    cout << chrono::duration_cast<chrono::microseconds>(copying).count() << " us, puts : "
+         << chrono::duration_cast<chrono::microseconds>(putting).count() << " us ("
+         << copy.size() << ")" << endl;
+
+    original.clear();
+    copy.clear();
+    rebuilt.clear();
+}
+
+// Counts the bytes a container allocates, so that its
+// footprint can be put next to memoryUsage()
+template <class T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    // Points to the count shared by every copy
+    size_t *bytes;
+
+    CountingAllocator(size_t *bytes) : bytes(bytes)
+    {
+    }
+
+    template <class U>
+    CountingAllocator(const CountingAllocator<U> &other) : bytes(other.bytes)
+    {
+    }
+
+    T *allocate(size_t n)
+    {
+        *bytes += n * sizeof(T);
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *pointer, size_t n)
+    {
+        *bytes -= n * sizeof(T);
+        allocator<T>().deallocate(pointer, n);
+    }
+
+    template <class U>
+    bool operator==(const CountingAllocator<U> &other) const
+    {
+        return bytes == other.bytes;
+    }
+
+    template <class U>
+    bool operator!=(const CountingAllocator<U> &other) const
+    {
+        return bytes != other.bytes;
+    }
+};
+
+int main()
+{
+    // Create a new Compact Hash Table
+    CompactHashTable<string, string> table;
+
+    table.put("adam", "19");
+    table.put("eve", "22");
+    table.put("john", "4");
+
+    table.printTable();
+
+    string result;
+    if (table.get("eve", result))
+        cout << result << endl;
+
+    // Compare the footprint against an unordered_map,
+    // which allocates every Entry on its own
+    size_t mapBytes = 0;
+    unordered_map<int, int, hash<int>, equal_to<int>, CountingAllocator<pair<const int, int>>>
+        map(0, hash<int>(), equal_to<int>(), CountingAllocator<pair<const int, int>>(&mapBytes));
+    CompactHashTable<int, int> compact;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        map[i] = i;
+        compact.put(i, i);
+    }
+
+    int value;
+
+    compact.remove(7);
+    cout << compact.get(7, value) << " " << compact.size() << endl;
+
+    // A key keeps a single Entry however often it is put()
+    compact.put(8, 64);
+    compact.update(8, [](int &value)
+                   { value++; });
+    cout << compact.get(8, value) << " " << value << " " << compact.size() << endl;
+
+    cout << "Bytes per Entry : " << compact.memoryUsage() / (double)compact.size() << " vs unordered_map : "
+         << mapBytes / (double)map.size() << endl;
+
+    cout << compact.clear() << endl;
+
+    // Copying a CompactHashTable of trivially copyable Entries
+    // is a memcpy per slab, against putting every Entry again
+    cout << "Copy of ints : ";
+    copyAgainstPuts<int>(1000000);
+
+    cout << "Copy of Spans : ";
+    copyAgainstPuts<Span>(1000000);
+
+    return 0;
+}
@@ -0,0 +1,369 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         CuckooFilter.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Cuckoo Filter in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Moved out of GenericHashTable.cpp, bounds the
+ *                         buckets reserved by deserialize()
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef CUCKOO_FILTER_H
+#define CUCKOO_FILTER_H
+
+#include <istream>
+#include <ostream>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+
+#include "../Serialization/ChunkStream.h"
+
+// Marks the start of a serialized Cuckoo Filter ("FLT1")
+const uint32_t FILTER_MAGIC = 0x31544C46;
+
+/**
+ * Answers "might this key be in the set?" in a few bytes per key.
+ * A "no" is always right, while a "yes" is wrong about 1 time in
+ * 8000, so a Table can skip its buckets for most missing keys.
+ *
+ * Each key is kept as a 16 bit fingerprint in one of two buckets
+ * of 4 slots. A bucket is packed in a single uint64_t, so looking
+ * for a fingerprint compares all 4 slots at once instead of one at
+ * a time. Like a Cuckoo Hash Table, a new fingerprint that finds
+ * both buckets full moves another fingerprint to its other bucket.
+ *
+ * Unlike a Bloom filter, fingerprints can be removed again, as
+ * long as only keys that were added are removed.
+ */
+template <class K>
+class CuckooFilter
+{
+    // Holds the most fingerprints add() moves before giving up
+    static const int MAX_KICKS = 500;
+
+    // Hold 1 and the top bit of each 16 bit slot
+    static const uint64_t LOW_BITS = 0x0001000100010001ull;
+    static const uint64_t HIGH_BITS = 0x8000800080008000ull;
+
+    // Holds the buckets, 4 fingerprints each (0 is a free slot)
+    std::vector<uint64_t> buckets;
+
+    // Holds the number of buckets - 1 (the number is a power of two)
+    size_t mask;
+
+    // Holds the number of fingerprints
+    size_t count;
+
+    // Holds the last fingerprint moved by a failed add(), and its
+    // bucket, so that it isn't lost (0 if there is none)
+    uint16_t victim;
+    size_t victimBucket;
+
+    // Holds the state of the random number generator
+    uint64_t randomState;
+
+    // Mixes the bits of a hash (MurmurHash3's finalizer)
+    static uint64_t mix(uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+
+        return hash;
+    }
+
+    // Tells if any slot of a bucket holds a fingerprint
+    // (0 checks for a free slot)
+    static bool hasFingerprint(uint64_t bucket, uint16_t fingerprint)
+    {
+        // Slots holding the fingerprint become 0 ...
+        uint64_t word = bucket ^ (fingerprint * LOW_BITS);
+
+        // ... and only a 0 slot borrows into its own top bit
+        return (word - LOW_BITS) & ~word & HIGH_BITS;
+    }
+
+    // Returns the fingerprint in a slot of a bucket
+    static uint16_t getSlot(uint64_t bucket, int slot)
+    {
+        return (uint16_t)(bucket >> (slot * 16));
+    }
+
+    // Puts a fingerprint in a slot of a bucket
+    static void setSlot(uint64_t &bucket, int slot, uint16_t fingerprint)
+    {
+        bucket &= ~(0xFFFFull << (slot * 16));
+        bucket |= (uint64_t)fingerprint << (slot * 16);
+    }
+
+    // Returns the fingerprint and first bucket of a key
+    void locate(const K &key, uint16_t &fingerprint, size_t &first)
+    {
+        uint64_t hash = mix(std::hash<K>()(key));
+
+        // 0 marks a free slot, so no fingerprint can be 0
+        fingerprint = (uint16_t)(hash >> 48);
+        if (!fingerprint)
+            fingerprint = 1;
+
+        first = hash & mask;
+    }
+
+    // Returns the other bucket of a fingerprint
+    // Depends only on the fingerprint, so it works
+    // without the key when the fingerprint is moved
+    size_t otherBucket(size_t bucket, uint16_t fingerprint)
+    {
+        return bucket ^ (mix(fingerprint) & mask);
+    }
+
+    // Puts a fingerprint in a free slot of a bucket
+    bool place(size_t bucket, uint16_t fingerprint)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            if (!getSlot(buckets[bucket], i))
+            {
+                setSlot(buckets[bucket], i, fingerprint);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Takes one copy of a fingerprint out of a bucket
+    bool takeOut(size_t bucket, uint16_t fingerprint)
+    {
+        if (!hasFingerprint(buckets[bucket], fingerprint))
+            return false;
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (getSlot(buckets[bucket], i) == fingerprint)
+            {
+                setSlot(buckets[bucket], i, 0);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+public:
+    // Constructor
+    // Makes room for about capacity keys
+    CuckooFilter(size_t capacity = 64)
+    {
+        size_t size = 1;
+
+        // Keep the buckets at most 90% full
+        while (size * 4 * 9 < capacity * 10)
+            size *= 2;
+
+        buckets.assign(size, 0);
+        mask = size - 1;
+        count = 0;
+        victim = 0;
+        victimBucket = 0;
+        randomState = 0x9E3779B97F4A7C15ull;
+    }
+
+    // Adds a key to the Filter
+    // Returns false if the Filter is too full, a bigger one is needed
+    bool add(const K &key)
+    {
+        // The last add() already ran out of room
+        if (victim)
+            return false;
+
+        uint16_t fingerprint;
+        size_t bucket;
+        locate(key, fingerprint, bucket);
+
+        // Try both buckets first
+        if (place(bucket, fingerprint) || place((bucket = otherBucket(bucket, fingerprint)), fingerprint))
+        {
+            count++;
+            return true;
+        }
+
+        // Move a random fingerprint to its other bucket,
+        // and so on until one of them finds a free slot
+        for (int kicks = 0; kicks < MAX_KICKS; kicks++)
+        {
+            // xorshift64
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 7;
+            randomState ^= randomState << 17;
+
+            int slot = randomState & 3;
+            uint16_t evicted = getSlot(buckets[bucket], slot);
+
+            setSlot(buckets[bucket], slot, fingerprint);
+            fingerprint = evicted;
+            bucket = otherBucket(bucket, fingerprint);
+
+            if (place(bucket, fingerprint))
+            {
+                count++;
+                return true;
+            }
+        }
+
+        // Keep the fingerprint left over, the key itself is in
+        victim = fingerprint;
+        victimBucket = bucket;
+        count++;
+
+        return true;
+    }
+
+    // Tells if a key might be in the Filter
+    // false means it certainly is not
+    bool mayContain(const K &key)
+    {
+        uint16_t fingerprint;
+        size_t first;
+        locate(key, fingerprint, first);
+
+        size_t second = otherBucket(first, fingerprint);
+
+        return hasFingerprint(buckets[first], fingerprint) ||
+               hasFingerprint(buckets[second], fingerprint) ||
+               (victim == fingerprint && (victimBucket == first || victimBucket == second));
+    }
+
+    // Removes a key that was added to the Filter
+    // Removing a key that wasn't added can remove another key's fingerprint
+    bool remove(const K &key)
+    {
+        uint16_t fingerprint;
+        size_t first;
+        locate(key, fingerprint, first);
+
+        size_t second = otherBucket(first, fingerprint);
+
+        if (takeOut(first, fingerprint) || takeOut(second, fingerprint))
+        {
+            count--;
+
+            // There is room for the left over fingerprint now
+            if (victim && (place(victimBucket, victim) || place(otherBucket(victimBucket, victim), victim)))
+                victim = 0;
+
+            return true;
+        }
+
+        if (victim == fingerprint && (victimBucket == first || victimBucket == second))
+        {
+            victim = 0;
+            count--;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Returns the number of keys in the Filter
+    size_t size()
+    {
+        return count;
+    }
+
+    // Returns the number of keys the Filter has slots for
+    size_t capacity()
+    {
+        return buckets.size() * 4;
+    }
+
+    // Clears the entire Filter
+    int clear()
+    {
+        int counter = count;
+
+        buckets.assign(buckets.size(), 0);
+        count = 0;
+        victim = 0;
+
+        return counter;
+    }
+
+    // Writes the Filter to a stream in binary chunks
+    bool serialize(std::ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, FILTER_MAGIC, checksummed);
+
+        // The first record describes the Filter
+        writer.write((uint64_t)buckets.size());
+        writer.write((uint64_t)count);
+        writer.write(victim);
+        writer.write((uint64_t)victimBucket);
+        writer.endRecord();
+
+        // Then a record per bucket
+        for (uint64_t bucket : buckets)
+        {
+            writer.write(bucket);
+            writer.endRecord();
+        }
+
+        return writer.finish();
+    }
+
+    // Replaces the Filter with one written by serialize()
+    bool deserialize(std::istream &in)
+    {
+        ChunkReader reader(in, FILTER_MAGIC);
+        uint64_t size, keys, bucket;
+        uint16_t leftOver;
+
+        if (!reader.nextRecord() || !reader.read(size) || !reader.read(keys) ||
+            !reader.read(leftOver) || !reader.read(bucket))
+            return false;
+
+        // The number of buckets must be a power of two
+        if (!size || (size & (size - 1)) || bucket >= size)
+            return false;
+
+        // The slots (and a left over fingerprint) must hold every key
+        if (keys / 4 > size)
+            return false;
+
+        // size was read off the stream, so only a chunk's worth of
+        // buckets is reserved up front; the rest grows as they are read
+        std::vector<uint64_t> loaded;
+        loaded.reserve(std::min<uint64_t>(size, SERIALIZE_CHUNK_SIZE / sizeof(uint64_t)));
+
+        for (uint64_t word; loaded.size() < size && reader.nextRecord() && reader.read(word);)
+            loaded.push_back(word);
+
+        // Read to the end marker
+        while (reader.nextRecord())
+            ;
+
+        if (!reader.succeeded() || loaded.size() != size)
+            return false;
+
+        buckets.swap(loaded);
+        mask = size - 1;
+        count = keys;
+        victim = leftOver;
+        victimBucket = bucket;
+
+        return true;
+    }
+};
+
+#endif
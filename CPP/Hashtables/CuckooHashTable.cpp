@@ -0,0 +1,760 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         CuckooHashTable.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Bucketized Cuckoo Hash Table in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : main times get() against std::unordered_map
+ * 2026-October-19	[AG] : A moved from container is empty and usable
+ * 2026-October-19	[AG] : Added copy, move and swap()
+ * 2026-October-19	[AG] : Free old bucket arrays through EpochReclaimer
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <type_traits>
+
+#include "../Concurrency/MemoryReclamation.h"
+
+using namespace std;
+
+/**
+ * Every key has exactly two "buckets" it may live in, and each
+ * bucket has 4 slots. So get() looks at no more than 8 slots in
+ * two cache lines, however full the Table is; there are no
+ * Collision Lists to walk.
+ *
+ * When both buckets of a new key are full, put() searches
+ * (breadth first) for a chain of keys that can each move over to
+ * their other bucket, ending at a bucket with a free slot, and
+ * shifts them along it. If there is no such chain, the Table grows.
+ */
+
+// Holds the number of slots in a bucket
+const int CUCKOO_SLOTS = 4;
+
+// Represents a "bucket", sized and aligned to a cache line for int keys
+template <class K, class V>
+struct alignas(64) Bucket
+{
+    // Bumped to odd before the bucket changes, and back to even after
+    // (only used by Tables with concurrent reads)
+    atomic<uint32_t> version;
+
+    // Bit i is set while slot i holds a key
+    uint8_t occupied;
+
+    // Hold the keys and values of the slots
+    K keys[CUCKOO_SLOTS];
+    V values[CUCKOO_SLOTS];
+
+    // Constructor
+    Bucket() : keys(), values()
+    {
+        version.store(0, memory_order_relaxed);
+        occupied = 0;
+    }
+};
+
+// Represents the array of buckets
+template <class K, class V>
+struct BucketArray
+{
+    // Points to the buckets
+    Bucket<K, V> *buckets;
+
+    // Holds the number of buckets - 1 (the number is a power of two)
+    size_t mask;
+
+    // Constructor
+    BucketArray(size_t count)
+    {
+        buckets = new Bucket<K, V>[count];
+        mask = count - 1;
+    }
+
+    // Destructor
+    ~BucketArray()
+    {
+        delete[] buckets;
+    }
+};
+
+// Represents a step of a displacement search
+struct PathNode
+{
+    // Holds the bucket this step reached
+    size_t bucket;
+
+    // Holds the step before this one, -1 for the key's own buckets
+    int parent;
+
+    // Holds the slot of the parent's bucket whose key moves here
+    int slot;
+};
+
+// Represents the Cuckoo Hash Table
+//
+// With Concurrent set, put(), remove() and clear() are serialized by
+// a lock, while get() takes no lock at all : it reads the version of
+// both buckets, searches them, and tries again if either version
+// changed meanwhile (or was odd, meaning a write was under way).
+// Keys are always copied into their new slot before being cleared
+// from the old one, so a key being moved is never missing
+template <class K, class V, bool Concurrent = false>
+class CuckooHashTable
+{
+    // Holds the most steps a displacement search may take
+    static const int MAX_SEARCH = 512;
+
+    // Points to the current array of buckets
+    atomic<BucketArray<K, V> *> table;
+
+    // Holds the number of key-value pairs
+    size_t count;
+
+    // Serializes writers (only used with Concurrent set)
+    mutex writeLock;
+
+    // Mixes the bits of a hash (MurmurHash3's finalizer)
+    static uint64_t mix(uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+
+        return hash;
+    }
+
+    // Returns the two buckets of a key
+    static void getBuckets(const K &key, size_t mask, size_t &first, size_t &second)
+    {
+        uint64_t hash = mix(std::hash<K>()(key));
+
+        first = hash & mask;
+        second = mix(hash ^ 0x9E3779B97F4A7C15ull) & mask;
+
+        // Always give a key two different buckets
+        if (first == second)
+            second = first ^ 1;
+    }
+
+    // Returns the other bucket of a key that is in bucket
+    static size_t otherBucket(const K &key, size_t mask, size_t bucket)
+    {
+        size_t first, second;
+        getBuckets(key, mask, first, second);
+
+        return bucket == first ? second : first;
+    }
+
+    // Returns the slot holding key in a bucket, or -1
+    static int findSlot(Bucket<K, V> &bucket, const K &key)
+    {
+        for (int i = 0; i < CUCKOO_SLOTS; i++)
+        {
+            if ((bucket.occupied & (1 << i)) && key == bucket.keys[i])
+                return i;
+        }
+
+        return -1;
+    }
+
+    // Returns a free slot of a bucket, or -1
+    static int freeSlot(Bucket<K, V> &bucket)
+    {
+        for (int i = 0; i < CUCKOO_SLOTS; i++)
+        {
+            if (!(bucket.occupied & (1 << i)))
+                return i;
+        }
+
+        return -1;
+    }
+
+    // Mark the start and end of a change to a bucket for readers
+    void beginWrite(Bucket<K, V> &bucket)
+    {
+        if constexpr (Concurrent)
+        {
+            bucket.version.store(bucket.version.load(memory_order_relaxed) + 1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_release);
+        }
+    }
+
+    void endWrite(Bucket<K, V> &bucket)
+    {
+        if constexpr (Concurrent)
+            bucket.version.store(bucket.version.load(memory_order_relaxed) + 1, memory_order_release);
+    }
+
+    // Tells if a bucket is already on the path to a step
+    static bool onPath(PathNode *path, int step, size_t bucket)
+    {
+        for (; step >= 0; step = path[step].parent)
+        {
+            if (path[step].bucket == bucket)
+                return true;
+        }
+
+        return false;
+    }
+
+    // Searches breadth first from a key's buckets for a bucket with a free slot
+    // Returns the step that reached it, or -1 if there is none close enough
+    static int findPath(BucketArray<K, V> *array, size_t first, size_t second, PathNode *path)
+    {
+        int steps = 0;
+
+        path[steps++] = {first, -1, -1};
+        path[steps++] = {second, -1, -1};
+
+        for (int current = 0; current < steps; current++)
+        {
+            Bucket<K, V> &bucket = array->buckets[path[current].bucket];
+
+            // Found a free slot
+            if (freeSlot(bucket) >= 0)
+                return current;
+
+            // Else, each of its keys could move to its other bucket
+            for (int i = 0; i < CUCKOO_SLOTS && steps < MAX_SEARCH; i++)
+            {
+                size_t next = otherBucket(bucket.keys[i], array->mask, path[current].bucket);
+
+                // Don't go round in circles
+                if (!onPath(path, current, next))
+                    path[steps++] = {next, current, i};
+            }
+        }
+
+        return -1;
+    }
+
+    // Adds a new key to an array of buckets, moving other keys if needed
+    // Returns false if no bucket could be freed
+    bool insertNew(BucketArray<K, V> *array, const K &key, const V &value)
+    {
+        size_t first, second;
+        getBuckets(key, array->mask, first, second);
+
+        PathNode path[MAX_SEARCH];
+        int step = findPath(array, first, second, path);
+
+        if (step < 0)
+            return false;
+
+        int slot = freeSlot(array->buckets[path[step].bucket]);
+
+        // Shift the keys along the path, starting from its free end
+        for (; path[step].parent >= 0; step = path[step].parent)
+        {
+            Bucket<K, V> &from = array->buckets[path[path[step].parent].bucket];
+            Bucket<K, V> &to = array->buckets[path[step].bucket];
+            int fromSlot = path[step].slot;
+
+            // Copy the key to its other bucket first ...
+            beginWrite(to);
+            to.keys[slot] = from.keys[fromSlot];
+            to.values[slot] = from.values[fromSlot];
+            to.occupied |= (1 << slot);
+            endWrite(to);
+
+            // ... and only then free its old slot
+            beginWrite(from);
+            from.occupied &= ~(1 << fromSlot);
+            endWrite(from);
+
+            slot = fromSlot;
+        }
+
+        // One of the key's own buckets now has a free slot
+        Bucket<K, V> &bucket = array->buckets[path[step].bucket];
+
+        beginWrite(bucket);
+        bucket.keys[slot] = key;
+        bucket.values[slot] = value;
+        bucket.occupied |= (1 << slot);
+        endWrite(bucket);
+
+        return true;
+    }
+
+    // Doubles the number of buckets
+    void grow()
+    {
+        BucketArray<K, V> *current = table.load(memory_order_relaxed);
+        size_t size = (current->mask + 1) * 2;
+
+        // Move every key into a bigger array (which nobody
+        // else can see yet), growing further if one doesn't fit
+        BucketArray<K, V> *bigger = nullptr;
+
+        for (bool moved = false; !moved; size *= 2)
+        {
+            delete bigger;
+            bigger = new BucketArray<K, V>(size);
+            moved = true;
+
+            for (size_t b = 0; b <= current->mask && moved; b++)
+            {
+                Bucket<K, V> &bucket = current->buckets[b];
+
+                for (int i = 0; i < CUCKOO_SLOTS && moved; i++)
+                {
+                    if (bucket.occupied & (1 << i))
+                        moved = insertNew(bigger, bucket.keys[i], bucket.values[i]);
+                }
+            }
+        }
+
+        table.store(bigger, memory_order_release);
+
+        // Readers may still be in the old array
+        if constexpr (Concurrent)
+            EpochReclaimer::retire(current);
+        else
+            delete current;
+    }
+
+    // Gets the value of a key without taking a lock
+    bool getOptimistic(const K &key, V &value)
+    {
+        static_assert(is_trivially_copyable<K>::value && is_trivially_copyable<V>::value,
+                      "Concurrent reads need trivially copyable keys and values");
+
+        // Keeps an array replaced by grow() from being freed under us
+        EpochReclaimer::Guard guard;
+
+        while (true)
+        {
+            BucketArray<K, V> *array = table.load(memory_order_acquire);
+
+            // A moved from Table has no buckets
+            if (!array)
+                return false;
+
+            size_t first, second;
+            getBuckets(key, array->mask, first, second);
+
+            Bucket<K, V> &firstBucket = array->buckets[first];
+            Bucket<K, V> &secondBucket = array->buckets[second];
+
+            uint32_t firstVersion = firstBucket.version.load(memory_order_acquire);
+            uint32_t secondVersion = secondBucket.version.load(memory_order_acquire);
+
+            // A write is under way, try again
+            if ((firstVersion | secondVersion) & 1)
+            {
+                this_thread::yield();
+                continue;
+            }
+
+            V result = V();
+            int slot = findSlot(firstBucket, key);
+            bool found = slot >= 0;
+
+            if (found)
+                result = firstBucket.values[slot];
+            else if ((slot = findSlot(secondBucket, key)) >= 0)
+            {
+                result = secondBucket.values[slot];
+                found = true;
+            }
+
+            // Keep what was read, only if nothing changed while reading it
+            atomic_thread_fence(memory_order_acquire);
+
+            if (firstBucket.version.load(memory_order_relaxed) != firstVersion ||
+                secondBucket.version.load(memory_order_relaxed) != secondVersion ||
+                table.load(memory_order_relaxed) != array)
+                continue;
+
+            if (found)
+                value = result;
+
+            return found;
+        }
+    }
+
+    // Locks out other writers, if the Table is Concurrent
+    unique_lock<mutex> lockForWriting()
+    {
+        return Concurrent ? unique_lock<mutex>(writeLock) : unique_lock<mutex>();
+    }
+
+public:
+    // Constructor
+    // initialSize is rounded up to a power of two
+    CuckooHashTable(size_t initialSize = 16)
+    {
+        size_t size = 2;
+
+        while (size < initialSize)
+            size *= 2;
+
+        table.store(new BucketArray<K, V>(size), memory_order_relaxed);
+        count = 0;
+    }
+
+    // Copy Constructor
+    // The copy gets buckets of its own, laid out like other's
+    // No thread may be writing to other meanwhile
+    CuckooHashTable(const CuckooHashTable &other)
+    {
+        BucketArray<K, V> *source = other.table.load(memory_order_acquire);
+        BucketArray<K, V> *array = new BucketArray<K, V>(source ? source->mask + 1 : 16);
+
+        for (size_t b = 0; source && b <= source->mask; b++)
+        {
+            Bucket<K, V> &from = source->buckets[b];
+            Bucket<K, V> &to = array->buckets[b];
+
+            to.occupied = from.occupied;
+
+            for (int i = 0; i < CUCKOO_SLOTS; i++)
+            {
+                if (from.occupied & (1 << i))
+                {
+                    to.keys[i] = from.keys[i];
+                    to.values[i] = from.values[i];
+                }
+            }
+        }
+
+        table.store(array, memory_order_relaxed);
+        count = other.count;
+    }
+
+    // Move Constructor
+    // Takes other's buckets in O(1)
+    // other is left empty, and only gets buckets again on its next put()
+    CuckooHashTable(CuckooHashTable &&other) noexcept
+    {
+        table.store(other.table.exchange(nullptr, memory_order_relaxed), memory_order_relaxed);
+        count = other.count;
+
+        other.count = 0;
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the Table moved from),
+    // so its buckets are taken and ours go away with it
+    // No other thread may be using either Table
+    CuckooHashTable &operator=(CuckooHashTable other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    // No other thread may be using the Table by now
+    ~CuckooHashTable()
+    {
+        delete table.load();
+    }
+
+    // Trades buckets with another Table
+    // No other thread may be using either Table
+    void swap(CuckooHashTable &other) noexcept
+    {
+        BucketArray<K, V> *array = table.load(memory_order_relaxed);
+
+        table.store(other.table.load(memory_order_relaxed), memory_order_relaxed);
+        other.table.store(array, memory_order_relaxed);
+
+        std::swap(count, other.count);
+    }
+
+    // Adds a value to the Table, replacing the value of an existing key
+    void put(K key, V value)
+    {
+        auto guard = lockForWriting();
+        BucketArray<K, V> *array = table.load(memory_order_relaxed);
+
+        // A moved from Table needs buckets again
+        if (!array)
+            table.store((array = new BucketArray<K, V>(16)), memory_order_release);
+
+        size_t first, second;
+        getBuckets(key, array->mask, first, second);
+
+        // Key found, replace its value
+        for (size_t b : {first, second})
+        {
+            Bucket<K, V> &bucket = array->buckets[b];
+            int slot = findSlot(bucket, key);
+
+            if (slot >= 0)
+            {
+                beginWrite(bucket);
+                bucket.values[slot] = value;
+                endWrite(bucket);
+
+                return;
+            }
+        }
+
+        // Grow until there is room for the new key
+        while (!insertNew(table.load(memory_order_relaxed), key, value))
+            grow();
+
+        count++;
+    }
+
+    // Gets the value of a key from the Table
+    bool get(K key, V &value)
+    {
+        if constexpr (Concurrent)
+            return getOptimistic(key, value);
+
+        BucketArray<K, V> *array = table.load(memory_order_relaxed);
+
+        // A moved from Table has no buckets
+        if (!array)
+            return false;
+
+        size_t first, second;
+        getBuckets(key, array->mask, first, second);
+
+        // Look in both of the key's buckets, and nowhere else
+        for (size_t b : {first, second})
+        {
+            Bucket<K, V> &bucket = array->buckets[b];
+            int slot = findSlot(bucket, key);
+
+            // Key found
+            if (slot >= 0)
+            {
+                value = bucket.values[slot];
+                return true;
+            }
+        }
+
+        // No such key in the Table
+        return false;
+    }
+
+    // Removes a key-value pair from the Table
+    bool remove(K key)
+    {
+        auto guard = lockForWriting();
+        BucketArray<K, V> *array = table.load(memory_order_relaxed);
+
+        // A moved from Table has no buckets
+        if (!array)
+            return false;
+
+        size_t first, second;
+        getBuckets(key, array->mask, first, second);
+
+        for (size_t b : {first, second})
+        {
+            Bucket<K, V> &bucket = array->buckets[b];
+            int slot = findSlot(bucket, key);
+
+            // Key found, free its slot
+            if (slot >= 0)
+            {
+                beginWrite(bucket);
+                bucket.occupied &= ~(1 << slot);
+                endWrite(bucket);
+
+                count--;
+                return true;
+            }
+        }
+
+        // No such key in the Table
+        return false;
+    }
+
+    // Returns the number of key-value pairs
+    size_t size()
+    {
+        return count;
+    }
+
+    // Clears the entire Table
+    int clear()
+    {
+        auto guard = lockForWriting();
+        BucketArray<K, V> *array = table.load(memory_order_relaxed);
+
+        int counter = 0;
+
+        for (size_t b = 0; array && b <= array->mask; b++)
+        {
+            Bucket<K, V> &bucket = array->buckets[b];
+
+            // Skip empty buckets
+            if (!bucket.occupied)
+                continue;
+
+            beginWrite(bucket);
+
+            for (int i = 0; i < CUCKOO_SLOTS; i++)
+            {
+                if (bucket.occupied & (1 << i))
+                {
+                    // Let go of what the key and value hold
+                    bucket.keys[i] = K();
+                    bucket.values[i] = V();
+                    counter++;
+                }
+            }
+
+            bucket.occupied = 0;
+            endWrite(bucket);
+        }
+
+        count = 0;
+        return counter;
+    }
+
+    // Prints the entire Hash Table
+    void printTable()
+    {
+        BucketArray<K, V> *array = table.load(memory_order_relaxed);
+
+        // Print the Entries in each "bucket"
+        for (size_t b = 0; array && b <= array->mask; b++)
+        {
+            Bucket<K, V> &bucket = array->buckets[b];
+            cout << "[" << b << "] => ";
+
+            for (int i = 0; i < CUCKOO_SLOTS; i++)
+            {
+                if (bucket.occupied & (1 << i))
+                    cout << "[" << bucket.keys[i] << " : " << bucket.values[i] << "] ";
+            }
+
+            cout << "\n";
+        }
+
+        cout << endl;
+    }
+};
+
+// Times n get()s that hit and n that miss on a Table of n keys,
+// against std::unordered_map, whose "buckets" are chained
+void cuckooAgainstChained(int n)
+{
+    CuckooHashTable<int, int> cuckoo;
+    unordered_map<int, int> chained;
+
+    for (int i = 0; i < n; i++)
+    {
+        cuckoo.put(i, i);
+        chained[i] = i;
+    }
+
+    long cuckooFound = 0, chainedFound = 0;
+    auto start = chrono::steady_clock::now();
+
+    // Keys 0 upto n are in the Table, n upto 2n are not
+    for (int i = 0; i < 2 * n; i++)
+    {
+        int value;
+        cuckooFound += cuckoo.get((unsigned)i * 2654435761u % (2 * n), value);
+    }
+
+    auto cuckooGet = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < 2 * n; i++)
+        chainedFound += chained.count((unsigned)i * 2654435761u % (2 * n));
+
+    auto chainedGet = chrono::steady_clock::now() - start;
+
+    cout << 2 * n << " get()s : " << chrono::duration_cast<chrono::microseconds>(cuckooGet).count() << " us, "
+         << "std::unordered_map : " << chrono::duration_cast<chrono::microseconds>(chainedGet).count() << " us ("
+         << (cuckooFound == chainedFound) << ")" << endl;
+
+    cuckoo.clear();
+}
+
+int main()
+{
+    // Create a new Cuckoo Hash Table
+    CuckooHashTable<string, string> table(4);
+
+    table.put("adam", "19");
+    table.put("eve", "22");
+    table.put("john", "4");
+    table.put("doe", "87");
+
+    table.printTable();
+
+    string result;
+    if (table.get("adam", result))
+        cout << result << endl;
+
+    table.remove("adam");
+    cout << table.get("adam", result) << endl;
+
+    // A copy has buckets of its own
+    CuckooHashTable<string, string> copy(table);
+    table.remove("eve");
+    cout << copy.get("eve", result) << " " << table.get("eve", result) << endl;
+
+    CuckooHashTable<string, string> moved(std::move(copy));
+    copy = moved;
+    cout << copy.clear() << endl;
+
+    cout << table.clear() << endl;
+
+    // One writer and three readers sharing a Table
+    CuckooHashTable<int, int, true> squares;
+    atomic<bool> done(false);
+    atomic<long> wrong(0);
+
+    vector<thread> readers;
+
+    for (int r = 0; r < 3; r++)
+    {
+        readers.push_back(thread([&]
+                                 {
+            while (!done.load())
+            {
+                for (int key = 0; key < 10000; key += 7)
+                {
+                    int square;
+                    if (squares.get(key, square) && square != key * key)
+                        wrong++;
+                }
+            } }));
+    }
+
+    for (int key = 0; key < 10000; key++)
+        squares.put(key, key * key);
+
+    done.store(true);
+
+    for (auto &reader : readers)
+        reader.join();
+
+    cout << squares.size() << " " << wrong.load() << endl;
+
+    // Half hits and half misses, against chained "buckets"
+    cuckooAgainstChained(1000000);
+
+    return 0;
+}
@@ -9,15 +9,69 @@
  * --------------------------------------------------------------------------------
  *
  * Revision History :
+ * 2026-October-19	[AG] : main times miss-heavy get()s with and without a Filter
+ * 2026-October-19	[AG] : RcuHashTable moved to RcuHashTable.cpp
+ * 2026-October-19	[AG] : CompactHashTable moved to CompactHashTable.cpp, DumpWriter
+ *                         and BackgroundFreer to headers of their own
+ * 2026-October-19	[AG] : remove() only logs keys it finds, log writes retry on EINTR
+ * 2026-October-19	[AG] : dump() reuses a buffer, writes NaN and infinity as null in JSON
+ * 2026-October-19	[AG] : Trivially copyable Entries are copied by slab and serialized in batches
+ * 2026-October-19	[AG] : A moved from container is empty and usable
+ * 2026-October-19	[AG] : clearAsync() hands storage to a BackgroundFreer
+ * 2026-October-19	[AG] : Added LOG_ASSIGN, CompactHashTable put() replaces values
+ * 2026-October-19	[AG] : Logs clear(), reports log failures, openLog() loads into a copy
+ * 2026-October-19	[AG] : openSnapshot() checks bucket offsets, saveSnapshot() fsync()s
+ * 2026-October-19	[AG] : CuckooFilter moved to CuckooFilter.h
+ * 2026-October-19	[AG] : Chunked streams come from ChunkStream.h
+ * 2026-October-19	[AG] : Added dump() in text, JSON and CSV, printTable() uses it
+ * 2026-October-19	[AG] : Added forEachParallel(), reduceParallel() and countIf()
+ * 2026-October-19	[AG] : Added copy, move, swap() and destructors
+ * 2026-October-19	[AG] : Fast paths for trivially copyable keys and values
+ * 2026-October-19	[AG] : Entries come from slabs, added clearAsync()
+ * 2026-October-19	[AG] : put() replaces values, added update() and HashMultiMap
+ * 2026-October-19	[AG] : Added RcuHashTable for lock-free snapshot reads
+ * 2026-October-19	[AG] : Added CompactHashTable and memoryUsage()
+ * 2026-October-19	[AG] : Added an optional CuckooFilter for missing keys
+ * 2026-October-19	[AG] : Added an optional write-ahead log
+ * 2026-October-19	[AG] : Added serialize() and deserialize()
+ * 2026-October-19	[AG] : Added saveSnapshot() and openSnapshot()
  * 2020-August-09	[SP] : Created
  * --------------------------------------------------------------------------------
  */
 
 #include <iostream>
+#include <fstream>
 #include <string>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <type_traits>
+#include <sstream>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../Concurrency/Parallel.h"
+#include "../Concurrency/BackgroundFreer.h"
+#include "../Serialization/ChunkStream.h"
+#include "../Serialization/DumpWriter.h"
+#include "CuckooFilter.h"
 
 using namespace std;
 
+// Marks the start of a serialized Hash Table ("HTB1")
+const uint32_t TABLE_MAGIC = 0x31425448;
+
 // Represents an Entry
 template<class K, class V>
 struct Entry
@@ -32,209 +86,2290 @@ struct Entry
     Entry<K, V> *collisionEntry;
 
     // Constructor
-    Entry(K k, V v)
+    // The key and value are moved in, not made empty and then assigned
+    Entry(K k, V v) : value(std::move(v)), key(std::move(k))
     {
-        key = k;
-        value = v;
-
         collisionEntry = nullptr;
     }
 };
 
-// Represents the Hash Table
-template<class K, class V>
-class HashTable
-{
-    // Points to the "buckets"
-    Entry<K, V> **table;
+// Holds the most Entries a slab of EntrySlabs can have
+const size_t MAX_SLAB_ENTRIES = 4096;
 
-    // Holds the size of the Hash Table
-    int size;
+// Holds the number of buckets in each chunk of a parallel loop
+const int PARALLEL_CHUNK_BUCKETS = 256;
 
-    // Returns the hash of the Key
-    int getHash(K key)
+// Hands out memory for Entries from slabs, so that freeing a whole
+// Table frees a few slabs instead of every Entry one at a time
+//
+// The first slab holds 16 Entries and each one after holds
+// twice as many (upto MAX_SLAB_ENTRIES), so a small Table stays small
+template <class T>
+class EntrySlabs
+{
+    // Holds an Entry, or the next free Slot once it is destroyed
+    union Slot
     {
-        size_t hash = std::hash<K>()(key);
+        Slot *nextFree;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
 
-        return hash % size;
+    // Point to the slabs
+    vector<Slot *> slabs;
+
+    // Holds the number of Slots taken from the last slab
+    size_t used;
+
+    // Points to the first destroyed Slot
+    Slot *freeSlots;
+
+    // Holds the number of Entries alive
+    size_t count;
+
+    // Set while the Slots hold the Entries in the order they were made :
+    // no Slot is free, and no destroyed Entry's Slot has been reused
+    bool ordered;
+
+    // Returns the number of Slots in slab i
+    static size_t slabEntries(size_t i)
+    {
+        return i < 8 ? min(MAX_SLAB_ENTRIES, (size_t)16 << i) : MAX_SLAB_ENTRIES;
     }
 
 public:
     // Constructor
-    HashTable(int initialSize = 11)
+    EntrySlabs()
     {
-        // Create an array of pointers ("buckets")
-        table = new Entry<K, V> *[(size = initialSize)];
+        used = 0;
+        freeSlots = nullptr;
+        count = 0;
+        ordered = true;
+    }
 
-        for (int i = 0; i < size; i++)
-            table[i] = nullptr;
+    // The slabs belong to one Table
+    EntrySlabs(const EntrySlabs &) = delete;
+    EntrySlabs &operator=(const EntrySlabs &) = delete;
 
+    // Destructor
+    // Entries still in the slabs must need no destructor,
+    // or have been destroyed already
+    ~EntrySlabs()
+    {
+        release();
     }
-    // Adds a value to the Hash Table
-    void put(K key, V value)
+
+    // Makes an Entry in a free Slot
+    template <class... Args>
+    T *create(Args &&...args)
     {
-        // If the table exists
-        // Create a new Entry
-        Entry<K, V> *newEntry = new Entry<K, V>(key, value);
+        Slot *slot = freeSlots;
 
-        // Get the hash of the Key
-        int hash = getHash(key);
+        // Reuse a destroyed Entry's Slot first
+        if (slot)
+        {
+            freeSlots = slot->nextFree;
+            ordered = false;
+        }
 
-        // If this is a collision
-        if (table[hash])
+        // Else take the next Slot of the last slab,
+        // adding a slab when it is full
+        else
         {
-            // Add newEntry at the front of the
-            // Collision List
-            newEntry->collisionEntry = table[hash];
+            if (slabs.empty() || used == slabEntries(slabs.size() - 1))
+            {
+                slabs.push_back(new Slot[slabEntries(slabs.size())]);
+                used = 0;
+            }
+
+            slot = &slabs.back()[used++];
         }
 
-        // Point table hash to the newEntry
-        table[hash] = newEntry;
+        count++;
+
+        return new (slot->storage) T(std::forward<Args>(args)...);
     }
 
-    // Gets the value of a key from the Hash Table
+    // Destroys an Entry made by create() and keeps its Slot
+    void destroy(T *entry)
+    {
+        entry->~T();
+
+        Slot *slot = (Slot *)entry;
+        slot->nextFree = freeSlots;
+        freeSlots = slot;
+
+        count--;
+        ordered = false;
+    }
+
+    // Frees every slab at once, without destroying the Entries in them
+    void release()
+    {
+        for (auto slab : slabs)
+            delete[] slab;
+
+        slabs.clear();
+        used = 0;
+        freeSlots = nullptr;
+        count = 0;
+        ordered = true;
+    }
+
+    // Copies other's slabs into this empty EntrySlabs, a memcpy each
+    //
+    // Only for a trivially copyable T, and only while other's Slots
+    // are in order : a free Slot holds a free list link, not an Entry,
+    // and a reused one would put its Entry out of order. Returns false,
+    // copying nothing, otherwise. Links the Entries hold still point
+    // into other's slabs, so the caller links the copies again
+    bool copySlabs(const EntrySlabs &other)
+    {
+        static_assert(is_trivially_copyable<T>::value, "Only trivially copyable Entries can be copied as bytes");
+
+        if (!other.ordered || !slabs.empty())
+            return false;
+
+        slabs.reserve(other.slabs.size());
+
+        for (size_t i = 0; i < other.slabs.size(); i++)
+        {
+            // Only the last slab may be partly used
+            size_t entries = i + 1 < other.slabs.size() ? slabEntries(i) : other.used;
+
+            Slot *slab = new Slot[slabEntries(i)];
+            memcpy((void *)slab, other.slabs[i], entries * sizeof(Slot));
+
+            slabs.push_back(slab);
+        }
+
+        used = other.used;
+        count = other.count;
+
+        return true;
+    }
+
+    // Calls function(entry) for every Entry, oldest first
+    // Only while the Slots are in order
+    template <class Function>
+    void forEachEntry(Function function)
+    {
+        for (size_t i = 0; i < slabs.size(); i++)
+        {
+            size_t entries = i + 1 < slabs.size() ? slabEntries(i) : used;
+
+            for (size_t j = 0; j < entries; j++)
+                function((T *)slabs[i][j].storage);
+        }
+    }
+
+    // Trades slabs with another EntrySlabs
+    void swap(EntrySlabs &other) noexcept
+    {
+        slabs.swap(other.slabs);
+        std::swap(used, other.used);
+        std::swap(freeSlots, other.freeSlots);
+        std::swap(count, other.count);
+        std::swap(ordered, other.ordered);
+    }
+
+    // Returns the number of Entries alive
+    size_t size()
+    {
+        return count;
+    }
+
+    // Returns the bytes held by the slabs
+    size_t memoryUsage()
+    {
+        size_t bytes = slabs.capacity() * sizeof(Slot *);
+
+        for (size_t i = 0; i < slabs.size(); i++)
+            bytes += slabEntries(i) * sizeof(Slot);
+
+        return bytes;
+    }
+};
+
+// Destroys the Entries of a "bucket" array, unless they need no destructor
+template <class K, class V>
+void destroyEntries(Entry<K, V> **table, int size)
+{
+    if constexpr (!is_trivially_destructible<Entry<K, V>>::value)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            for (auto current = table[i], next = current; current; current = next)
+            {
+                next = current->collisionEntry;
+                current->~Entry<K, V>();
+            }
+        }
+    }
+}
+
+// Sits at the front of a snapshot file
+//
+// A snapshot is laid out as :
+//    [SnapshotHeader]
+//    [uint64_t bucketOffsets[bucketCount + 1]]
+//    [SnapshotEntry<K, V> entries[entryCount]]
+//
+// Entries of "bucket" i are entries[bucketOffsets[i]] up to
+// entries[bucketOffsets[i + 1]], so the file holds offsets and
+// never pointers, and can be used straight from an mmap
+struct SnapshotHeader
+{
+    // Identifies the file as a Hash Table snapshot
+    uint32_t magic;
+
+    // Hold the sizes of the key and value types
+    // the snapshot was written with
+    uint32_t keySize;
+    uint32_t valueSize;
+
+    // Keeps the counts below 8-byte aligned
+    uint32_t reserved;
+
+    // Holds the number of "buckets"
+    uint64_t bucketCount;
+
+    // Holds the number of Entries
+    uint64_t entryCount;
+};
+
+// Marks a file as a Hash Table snapshot ("HTS1")
+const uint32_t SNAPSHOT_MAGIC = 0x31535448;
+
+// Snapshot Entries are written this many at a time
+const size_t SNAPSHOT_BLOCK_ENTRIES = 4096;
+
+// Represents an Entry as it is stored in a snapshot file
+template<class K, class V>
+struct SnapshotEntry
+{
+    // Holds the key of the Entry
+    K key;
+
+    // Holds the value of the Entry
+    V value;
+};
+
+// Represents a read-only Hash Table backed by
+// a memory mapped snapshot file
+template<class K, class V>
+class HashTableSnapshot
+{
+    // Points to the start of the mapped file
+    void *mapping;
+
+    // Holds the length of the mapped file
+    size_t length;
+
+    // Point into the mapped file
+    const SnapshotHeader *header;
+    const uint64_t *bucketOffsets;
+    const SnapshotEntry<K, V> *entries;
+
+    // Returns the hash of the Key
+    // (the same hash the HashTable used when it was saved)
+    uint64_t getHash(K key)
+    {
+        size_t hash = std::hash<K>()(key);
+
+        return hash % header->bucketCount;
+    }
+
+public:
+    // Constructor
+    // Takes ownership of an already validated mapping
+    HashTableSnapshot(void *mapping, size_t length)
+    {
+        this->mapping = mapping;
+        this->length = length;
+
+        header = (const SnapshotHeader *)mapping;
+        bucketOffsets = (const uint64_t *)(header + 1);
+        entries = (const SnapshotEntry<K, V> *)(bucketOffsets + header->bucketCount + 1);
+    }
+
+    // A snapshot owns its mapping, so it can't be copied
+    HashTableSnapshot(const HashTableSnapshot &) = delete;
+    HashTableSnapshot &operator=(const HashTableSnapshot &) = delete;
+
+    // Destructor
+    ~HashTableSnapshot()
+    {
+        close();
+    }
+
+    // Gets the value of a key from the snapshot
     bool get(K key, V &value)
     {
-        // If the table exists
-        if (table)
+        // If the snapshot is still mapped
+        if (mapping)
         {
             // Get the hash of the key
-            int hash = getHash(key);
+            uint64_t hash = getHash(key);
 
             // Search for the value in the "bucket"
-            for (auto current = table[hash]; current; current = current->collisionEntry)
+            for (uint64_t i = bucketOffsets[hash]; i < bucketOffsets[hash + 1]; i++)
             {
                 // Key found
-                if (key == current->key)
+                if (key == entries[i].key)
                 {
-                    value = current->value;
+                    value = entries[i].value;
                     return true;
                 }
             }
         }
 
-        // No such key in the Table
+        // No such key in the snapshot
         return false;
     }
 
-    // Removes a key-value pair from the Table
-    bool remove(K key)
+    // Returns the number of Entries in the snapshot
+    uint64_t count()
     {
-        // Get the hash of the key
-        int hash = getHash(key);
+        return mapping ? header->entryCount : 0;
+    }
 
-        // If the table exists
-        if (table)
+    // Unmaps the snapshot file
+    void close()
+    {
+        if (mapping)
         {
-            // Search for the key-value pair
-            for (auto current = table[hash], previous = current; current; current = current->collisionEntry)
-            {
-                // Key found
-                if (key == current->key)
-                {
-                    // If this pair is at the front of the Collision List
-                    if (table[hash] == current)
-                    {
-                        // Point table[hash] to current's next Entry
-                        table[hash] = current->collisionEntry;
-                    }
+            munmap(mapping, length);
+            mapping = nullptr;
+        }
+    }
+};
 
-                    // This value is at the end of the Collision List
-                    // or in the middle of the List
-                    else
-                    {
-                        // Point table[hash] to current's next Entry
-                        previous->collisionEntry = current->collisionEntry;
-                    }
+// Marks the start of a write-ahead log file ("WAL1")
+const uint32_t LOG_MAGIC = 0x314C4157;
 
-                    delete current;
-                    return true;
-                }
+// Kinds of mutation recorded in a write-ahead log
+const uint8_t LOG_PUT = 1;
+const uint8_t LOG_REMOVE = 2;
+const uint8_t LOG_CLEAR = 3;
 
-                // Assign previous to current
-                previous = current;
-            }
+// Replaces the value of a key, even in a HashMultiMap, where
+// a LOG_PUT adds another Entry
+const uint8_t LOG_ASSIGN = 4;
+
+/**
+ * Appends records to a log file with group commit.
+ *
+ * A log file is laid out as :
+ *    [magic : uint32] [reserved : uint32] [generation : uint64]
+ *    [length : uint32] [checksum : uint32] [record]
+ *    ...
+ *
+ * The generation goes up each time the log is compacted into
+ * a snapshot, so a log older than its snapshot is never replayed.
+ *
+ * With a flush interval, records are gathered in memory and a
+ * background thread writes and fdatasync()s them in one batch
+ * every interval. With a flush interval of 0, every record is
+ * written and synced before append() returns.
+ *
+ * Once a write or sync fails the log is broken : append() refuses
+ * every record after it, so the Table never gets ahead of its log.
+ */
+class WriteAheadLog
+{
+    // Holds the path of the log file
+    string path;
+
+    // The open log file
+    int fd;
+
+    // Holds the generation of the log file
+    uint64_t generation;
+
+    // Holds the flush interval in milliseconds
+    int flushInterval;
+
+    // Hold the framed records waiting to be written
+    // and the batch that is being written
+    string pending;
+    string writing;
+
+    // Count the records appended and the records on disk
+    uint64_t appended;
+    uint64_t durable;
+
+    // Set once a write or sync failed
+    bool failed;
+
+    // Guards everything above
+    mutex lock;
+
+    // Wakes the flusher early, and wakes sync() once a batch is on disk
+    condition_variable wakeFlusher;
+    condition_variable flushed;
+
+    // Set when sync() or close() wants the batch written now
+    bool syncRequested;
+    bool stopping;
+
+    // Writes batches in the background
+    thread flusher;
+
+    // Writes a whole buffer to the log file
+    bool writeAll(const string &buffer)
+    {
+        for (size_t written = 0; written < buffer.size();)
+        {
+            ssize_t count = ::write(fd, buffer.data() + written, buffer.size() - written);
+
+            // A signal came in before anything was written, try again
+            if (count < 0 && EINTR == errno)
+                continue;
+
+            if (count < 0)
+                return false;
+
+            written += count;
         }
-        // No such key in the Table
-        return false;
+
+        return true;
     }
 
-    // Clears the entire Table
-    int clear()
+    // Writes a fresh header, dropping every record in the file
+    bool reset(uint64_t newGeneration)
     {
-        int counter = 0;
+        uint32_t header[4] = { LOG_MAGIC, 0, 0, 0 };
+        memcpy(&header[2], &newGeneration, sizeof(newGeneration));
 
-        // If the table exists
-        if (table)
-        {
-            for (int i = 0; i < size; i++)
-            {
-                for (auto current = table[i]; current; current = table[i])
-                {
-                    // If there are no Entries in a "bucket"
-                    if (!table[i])
-                        continue;
+        if (ftruncate(fd, 0) < 0 || lseek(fd, 0, SEEK_SET) < 0)
+            return false;
 
-                    // Point table[hash] to the next Entry in the "bucket"
-                    table[i] = table[i]->collisionEntry;
+        string buffer((const char *)header, sizeof(header));
+        if (!writeAll(buffer) || fdatasync(fd) < 0)
+            return false;
 
-                    delete current;
-                    counter++;
-                }
-            }
-        }
-        return counter;
+        generation = newGeneration;
+        return true;
     }
 
-    // Prints the entire Hash Table
-    void printTable()
+    // Writes and syncs the pending batch
+    // Called with the lock held, drops it while writing
+    void writePending(unique_lock<mutex> &guard)
     {
-        // If the table exists
-        if (table)
-        {
-            string output = "\n";
+        if (pending.empty())
+            return;
 
-            // Print the Entries is each "bucket"
-            for (int i = 0; i < size; i++)
-            {
-                output += ("[" + to_string(i) + "] => ");
+        writing.swap(pending);
+        uint64_t batchEnd = appended;
 
-                for (auto current = table[i]; current; current = current->collisionEntry)
-                {
-                    output += ("[" + current->key + " : " + current->value + "] ");
+        // Other threads can keep appending while the batch is written
+        guard.unlock();
+        bool written = writeAll(writing) && fdatasync(fd) == 0;
+        guard.lock();
 
-                    if (current->collisionEntry)
-                        output += " => ";
-                }
+        writing.clear();
 
-                cout << output << endl;
-                output = "";
-            }
-        }
+        if (written)
+            durable = batchEnd;
+        else
+            failed = true;
+
+        flushed.notify_all();
     }
-};
 
-int main()
-{
-    // Create new Hash Table
-    HashTable<string, string> table;
+    // Runs on the flusher thread
+    void flushLoop()
+    {
+        unique_lock<mutex> guard(lock);
 
-    table.put("adam", "19");
-    table.put("eve", "22");
-    table.put("john", "4");
-    table.put("doe", "87");
+        while (!stopping)
+        {
+            wakeFlusher.wait_for(guard, chrono::milliseconds(flushInterval), [this]
+                                 { return stopping || syncRequested; });
 
-    table.printTable();
+            syncRequested = false;
+            writePending(guard);
+        }
 
-    string result;
-    if (table.get("adam", result))
-        cout << result << endl;
+        // Write whatever is left before closing
+        writePending(guard);
+    }
+
+public:
+    // Constructor
+    WriteAheadLog()
+    {
+        fd = -1;
+        generation = 0;
+        flushInterval = 0;
+        appended = durable = 0;
+        failed = syncRequested = stopping = false;
+    }
 
+    // A log owns its file and thread, so it can't be copied
+    WriteAheadLog(const WriteAheadLog &) = delete;
+    WriteAheadLog &operator=(const WriteAheadLog &) = delete;
 
-    table.remove("adam");
-    cout << table.get("adam", result) << endl;
+    // Destructor
+    ~WriteAheadLog()
+    {
+        close();
+    }
 
-    cout << table.clear() << endl;
+    // Opens (or creates) the log file and replays its records
+    // through apply(), which gets the start and end of each record.
+    // snapshotGeneration is the generation of the snapshot already loaded
+    bool open(const string &logPath, uint64_t snapshotGeneration, int flushIntervalMs,
+              const function<bool(const char *, const char *)> &apply)
+    {
+        path = logPath;
+        flushInterval = flushIntervalMs;
+
+        // Holds the length of the file upto the last good record
+        off_t validLength = 0;
+        bool stale = true;
+
+        ifstream file(path, ios::binary);
+        uint32_t header[4];
+
+        if (file.read((char *)header, sizeof(header)) && LOG_MAGIC == header[0])
+        {
+            memcpy(&generation, &header[2], sizeof(generation));
+
+            // The snapshot is missing records this log doesn't have
+            if (generation > snapshotGeneration)
+                return false;
+
+            // Else, if the log is older than the snapshot
+            // the snapshot already holds all of its records
+            stale = generation < snapshotGeneration;
+            validLength = sizeof(header);
+        }
+
+        // Replay records until the end of the file
+        // or until a torn or corrupt record
+        string record;
+        uint32_t frame[2];
+
+        while (!stale && file.read((char *)frame, sizeof(frame)))
+        {
+            // The length is read off the file, so a corrupt one
+            // must not be allocated for
+            if (frame[0] > SERIALIZE_RECORD_SIZE)
+                break;
+
+            record.resize(frame[0]);
+
+            if (!file.read(&record[0], frame[0]) ||
+                frame[1] != chunkChecksum(record.data(), frame[0]) ||
+                !apply(record.data(), record.data() + frame[0]))
+                break;
+
+            validLength += sizeof(frame) + frame[0];
+        }
+
+        file.close();
+
+        if ((fd = ::open(path.c_str(), O_WRONLY | O_CREAT, 0644)) < 0)
+            return false;
+
+        // Start a new log, or cut off whatever follows the last good record
+        if (stale || !validLength)
+        {
+            if (!reset(snapshotGeneration))
+                return false;
+        }
+        else if (ftruncate(fd, validLength) < 0 || lseek(fd, 0, SEEK_END) < 0)
+            return false;
+
+        if (flushInterval > 0)
+            flusher = thread(&WriteAheadLog::flushLoop, this);
+
+        return true;
+    }
+
+    // Appends a record to the log
+    // Returns false if the record is too big to replay or the log is
+    // broken. Without group commit that includes this record failing
+    // to be written; with it, only an earlier batch failing is known
+    bool append(const string &record)
+    {
+        if (record.size() > SERIALIZE_RECORD_SIZE)
+            return false;
+
+        uint32_t frame[2] = { (uint32_t)record.size(), chunkChecksum(record.data(), record.size()) };
+
+        unique_lock<mutex> guard(lock);
+
+        if (failed)
+            return false;
+
+        pending.append((const char *)frame, sizeof(frame));
+        pending.append(record);
+        appended++;
+
+        // No group commit, every record goes to disk right away
+        if (!flushInterval)
+            writePending(guard);
+
+        return !failed;
+    }
+
+    // Waits until every record appended so far is on disk
+    bool sync()
+    {
+        unique_lock<mutex> guard(lock);
+
+        if (flusher.joinable())
+        {
+            uint64_t target = appended;
+
+            syncRequested = true;
+            wakeFlusher.notify_one();
+
+            flushed.wait(guard, [&]
+                         { return durable >= target || failed; });
+        }
+
+        return !failed;
+    }
+
+    // Drops every record and moves the log to the next generation
+    // Only call this after sync(), once the snapshot is on disk
+    bool startGeneration(uint64_t newGeneration)
+    {
+        unique_lock<mutex> guard(lock);
+
+        return pending.empty() && reset(newGeneration);
+    }
+
+    // Returns the generation of the log file
+    uint64_t getGeneration()
+    {
+        return generation;
+    }
+
+    // Returns the path of the log file
+    const string &getPath()
+    {
+        return path;
+    }
+
+    // Writes everything that is pending and closes the log file
+    void close()
+    {
+        if (flusher.joinable())
+        {
+            {
+                lock_guard<mutex> guard(lock);
+                stopping = true;
+            }
+
+            wakeFlusher.notify_one();
+            flusher.join();
+        }
+
+        if (fd >= 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+};
+
+// Represents the Hash Table
+//
+// A key maps to one value : put() replaces the value of a key that is
+// already there. With Multi set (see HashMultiMap) put() always adds
+// a new Entry instead, so a key can map to many values
+template<class K, class V, bool Multi = false>
+class HashTable
+{
+    // Points to the "buckets"
+    Entry<K, V> **table;
+
+    // Holds the size of the Hash Table
+    int size;
+
+    // Holds the Entries
+    EntrySlabs<Entry<K, V>> entries;
+
+    // Points to the write-ahead log, if the Table has one
+    WriteAheadLog *log;
+
+    // Holds the record being built for the log
+    string logRecord;
+
+    // Holds the buffer of dump()
+    string dumpBuffer;
+
+    // Points to the Filter of the keys, if the Table has one
+    CuckooFilter<K> *filter;
+
+    // Holds the "buckets" and Entries clearAsync() took from the Table
+    struct Cleared
+    {
+        Entry<K, V> **table;
+        int size;
+        EntrySlabs<Entry<K, V>> entries;
+
+        // Constructor
+        // Starts out with empty "buckets", to trade for the Table's
+        Cleared(int size)
+        {
+            this->size = size;
+            table = new Entry<K, V> *[size]();
+        }
+
+        // Destructor
+        // Runs on the BackgroundFreer's thread
+        ~Cleared()
+        {
+            if (table)
+                destroyEntries(table, size);
+
+            delete[] table;
+        }
+    };
+
+    // Frees what clearAsync() takes from the Table
+    BackgroundFreer<Cleared> freer;
+
+    // Returns the hash of the Key
+    int getHash(K key)
+    {
+        size_t hash = std::hash<K>()(key);
+
+        return hash % size;
+    }
+
+    // Applies a record read back from the log
+    bool replayRecord(const char *cursor, const char *end)
+    {
+        uint8_t operation;
+        K key;
+        V value;
+
+        if (!readValue(cursor, end, operation))
+            return false;
+
+        if (LOG_CLEAR == operation)
+        {
+            clear();
+            return cursor == end;
+        }
+
+        if (!readValue(cursor, end, key))
+            return false;
+
+        if (LOG_REMOVE == operation)
+        {
+            remove(key);
+            return cursor == end;
+        }
+
+        if (LOG_PUT == operation && readValue(cursor, end, value))
+        {
+            put(key, value);
+            return cursor == end;
+        }
+
+        if (LOG_ASSIGN == operation && readValue(cursor, end, value))
+        {
+            assignEntry(key, value);
+            return cursor == end;
+        }
+
+        // Not a record we know
+        return false;
+    }
+
+    // Returns the first Entry with key from an Entry on down its Collision List
+    Entry<K, V> *findEntry(Entry<K, V> *current, K key)
+    {
+        for (; current; current = current->collisionEntry)
+        {
+            if (key == current->key)
+                return current;
+        }
+
+        return nullptr;
+    }
+
+    // Writes a put (or an assign) to the log, if the Table has one
+    // Returns false if the log couldn't take it
+    bool logPut(const K &key, const V &value, uint8_t operation = LOG_PUT)
+    {
+        if (!log)
+            return true;
+
+        logRecord.clear();
+        writeValue(logRecord, operation);
+        writeValue(logRecord, key);
+        writeValue(logRecord, value);
+
+        return log->append(logRecord);
+    }
+
+    // Writes a remove to the log, if the Table has one
+    // Returns false if the log couldn't take it
+    bool logRemove(const K &key)
+    {
+        if (!log)
+            return true;
+
+        logRecord.clear();
+        writeValue(logRecord, LOG_REMOVE);
+        writeValue(logRecord, key);
+
+        return log->append(logRecord);
+    }
+
+    // Writes a clear to the log, if the Table has one
+    // Returns false if the log couldn't take it
+    bool logClear()
+    {
+        if (!log)
+            return true;
+
+        logRecord.clear();
+        writeValue(logRecord, LOG_CLEAR);
+
+        return log->append(logRecord);
+    }
+
+    // Adds a key-value pair, or replaces the value of an existing key
+    // (the newest Entry of the key, if Multi is set), without logging
+    // Returns true if the key was new
+    bool assignEntry(const K &key, const V &value)
+    {
+        int hash = getHash(key);
+        Entry<K, V> *found = findEntry(table[hash], key);
+
+        // Key found, replace its value
+        if (found)
+        {
+            found->value = value;
+            return false;
+        }
+
+        linkEntry(hash, entries.create(key, value));
+        return true;
+    }
+
+    // Gives a moved from Table "buckets" again
+    void ensureTable()
+    {
+        if (!table)
+            table = new Entry<K, V> *[(size = 11)]();
+    }
+
+    // Adds a new Entry at the front of a "bucket"
+    void linkEntry(int hash, Entry<K, V> *newEntry)
+    {
+        // The Filter holds each key once
+        bool filtered = filter && findEntry(table[hash], newEntry->key);
+
+        // If this is a collision
+        if (table[hash])
+        {
+            // Add newEntry at the front of the
+            // Collision List
+            newEntry->collisionEntry = table[hash];
+        }
+
+        // Point table hash to the newEntry
+        table[hash] = newEntry;
+
+        // The Filter is full, build a bigger one
+        if (filter && !filtered && !filter->add(newEntry->key))
+            rebuildFilter(filter->capacity() * 2);
+    }
+
+    // Replaces the Filter with one holding every key of the Table
+    // A key put() more than once is only added the first time
+    void rebuildFilter(size_t capacity)
+    {
+        // Make room for every key, growing until they all fit
+        for (bool added = false; !added; capacity *= 2)
+        {
+            delete filter;
+            filter = new CuckooFilter<K>(capacity);
+            added = true;
+
+            for (int i = 0; i < size && added; i++)
+            {
+                for (auto current = table[i]; current && added; current = current->collisionEntry)
+                {
+                    if (findEntry(table[i], current->key) == current)
+                        added = filter->add(current->key);
+                }
+            }
+        }
+    }
+
+public:
+    // Constructor
+    HashTable(int initialSize = 11)
+    {
+        // Create an array of pointers ("buckets")
+        table = new Entry<K, V> *[(size = initialSize)];
+
+        for (int i = 0; i < size; i++)
+            table[i] = nullptr;
+
+        log = nullptr;
+        filter = nullptr;
+    }
+
+    // Copy Constructor
+    // The copy gets Entries of its own, in the same order, and a
+    // Filter if other has one. A log file belongs to a single
+    // Table, so the copy has none
+    HashTable(const HashTable &other) : HashTable(other.table ? other.size : 11)
+    {
+        bool copied = false;
+
+        // Trivially copyable Entries are copied slab by slab, instead
+        // of walking every Collision List of other. The copies are then
+        // linked in the order they were made, each at the front of its
+        // "bucket", which is the order put() left them in
+        if constexpr (is_trivially_copyable<Entry<K, V>>::value)
+        {
+            if (other.table && entries.copySlabs(other.entries))
+            {
+                entries.forEachEntry([&](Entry<K, V> *entry)
+                                     {
+                    int hash = getHash(entry->key);
+
+                    entry->collisionEntry = table[hash];
+                    table[hash] = entry; });
+
+                copied = true;
+            }
+        }
+
+        for (int i = 0; !copied && other.table && i < size; i++)
+        {
+            // Holds the link to point at the next copied Entry
+            Entry<K, V> **link = &table[i];
+
+            for (auto current = other.table[i]; current; current = current->collisionEntry)
+            {
+                *link = entries.create(current->key, current->value);
+                link = &(*link)->collisionEntry;
+            }
+        }
+
+        if (other.filter)
+            filter = new CuckooFilter<K>(*other.filter);
+    }
+
+    // Move Constructor
+    // Takes other's "buckets", Entries, log and Filter in O(1)
+    // other is left empty, and only gets "buckets" again on its next put()
+    HashTable(HashTable &&other) noexcept
+    {
+        table = nullptr;
+        size = 0;
+        log = nullptr;
+        filter = nullptr;
+
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the Table moved from),
+    // so everything it holds is taken and ours goes away with it
+    HashTable &operator=(HashTable other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    // Syncs the log, if the Table has one
+    ~HashTable()
+    {
+        closeLog();
+
+        if (table)
+            destroyEntries(table, size);
+
+        delete[] table;
+        delete filter;
+    }
+
+    // Trades everything with another Table
+    void swap(HashTable &other) noexcept
+    {
+        std::swap(table, other.table);
+        std::swap(size, other.size);
+        entries.swap(other.entries);
+        std::swap(log, other.log);
+        logRecord.swap(other.logRecord);
+        std::swap(filter, other.filter);
+    }
+
+    // Adds a value to the Hash Table
+    // Replaces the value of an existing key, unless Multi is set
+    // Returns false if the log couldn't record the put,
+    // in which case the Table is left as it was
+    bool put(K key, V value)
+    {
+        ensureTable();
+
+        // Log the put before making it
+        if (!logPut(key, value))
+            return false;
+
+        if constexpr (Multi)
+            linkEntry(getHash(key), entries.create(key, value));
+        else
+            assignEntry(key, value);
+
+        return true;
+    }
+
+    // Adds a key-value pair, or replaces the value of an existing key
+    // (the newest Entry of the key, if Multi is set)
+    // Returns true if the key was new. Returns false, and changes
+    // nothing, if the log couldn't record it (syncLog() tells so)
+    bool insertOrAssign(K key, V value)
+    {
+        ensureTable();
+
+        // Log the put before making it
+        // A LOG_PUT would replay as another Entry in a HashMultiMap
+        if (!logPut(key, value, LOG_ASSIGN))
+            return false;
+
+        return assignEntry(key, value);
+    }
+
+    // Adds a key with a value made from args, only if the key is new
+    // Nothing is made if the key is already there
+    // Returns true if the key was new (and the log could record it)
+    template <class... Args>
+    bool tryEmplace(K key, Args &&...args)
+    {
+        ensureTable();
+
+        int hash = getHash(key);
+
+        // Key found, leave it as it is
+        if (findEntry(table[hash], key))
+            return false;
+
+        Entry<K, V> *newEntry = entries.create(key, V(std::forward<Args>(args)...));
+
+        if (!logPut(key, newEntry->value))
+        {
+            entries.destroy(newEntry);
+            return false;
+        }
+
+        linkEntry(hash, newEntry);
+
+        return true;
+    }
+
+    // Calls change(value) on the value of a key, in place
+    // (the newest Entry of the key, if Multi is set)
+    // Returns false if there is no such key, or the log couldn't
+    // record the new value
+    template <class Function>
+    bool update(K key, Function change)
+    {
+        // A moved from Table has no "buckets"
+        if (!table)
+            return false;
+
+        Entry<K, V> *found = findEntry(table[getHash(key)], key);
+
+        // No such key in the Table
+        if (!found)
+            return false;
+
+        if (!log)
+        {
+            change(found->value);
+            return true;
+        }
+
+        // The new value is only known after the change, so it is
+        // made on a copy, and kept once the log has it
+        V changed = found->value;
+        change(changed);
+
+        if (!logPut(key, changed, LOG_ASSIGN))
+            return false;
+
+        found->value = std::move(changed);
+        return true;
+    }
+
+    // Points at the Entries of one key in a "bucket", newest first
+    class Iterator
+    {
+        // Points to the Entry, nullptr past the last one
+        Entry<K, V> *entry;
+
+    public:
+        // Constructor
+        Iterator(Entry<K, V> *entry)
+        {
+            this->entry = entry;
+        }
+
+        const K &key()
+        {
+            return entry->key;
+        }
+
+        V &value()
+        {
+            return entry->value;
+        }
+
+        // Moves to the next Entry with the same key
+        Iterator &operator++()
+        {
+            Entry<K, V> *current = entry->collisionEntry;
+
+            while (current && !(current->key == entry->key))
+                current = current->collisionEntry;
+
+            entry = current;
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return entry == other.entry;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return entry != other.entry;
+        }
+    };
+
+    // Returns the Entries of a key, as [first, last)
+    // There is at most one of them, unless Multi is set
+    pair<Iterator, Iterator> equalRange(K key)
+    {
+        // A moved from Table has no "buckets"
+        if (!table)
+            return make_pair(Iterator(nullptr), Iterator(nullptr));
+
+        return make_pair(Iterator(findEntry(table[getHash(key)], key)), Iterator(nullptr));
+    }
+
+    // Returns the number of Entries of a key
+    int count(K key)
+    {
+        int counter = 0;
+
+        for (auto range = equalRange(key); range.first != range.second; ++range.first)
+            counter++;
+
+        return counter;
+    }
+
+    // Gets the value of a key from the Hash Table
+    bool get(K key, V &value)
+    {
+        // The Filter knows the key is missing,
+        // so there is no need to walk the "bucket"
+        if (filter && !filter->mayContain(key))
+            return false;
+
+        // If the table exists
+        if (table)
+        {
+            // Get the hash of the key
+            int hash = getHash(key);
+
+            // Search for the value in the "bucket"
+            for (auto current = table[hash]; current; current = current->collisionEntry)
+            {
+                // Key found
+                if (key == current->key)
+                {
+                    value = current->value;
+                    return true;
+                }
+            }
+        }
+
+        // No such key in the Table
+        return false;
+    }
+
+    // Removes a key-value pair from the Table
+    // Returns false if there is no such key, or the log couldn't
+    // record the remove (the key is kept then)
+    bool remove(K key)
+    {
+        // A moved from Table has no "buckets", nor Entries
+        if (!table)
+            return false;
+
+        // Get the hash of the key
+        int hash = getHash(key);
+
+        // No such key, so there is nothing to log
+        if (!findEntry(table[hash], key))
+            return false;
+
+        // Log the remove before making it
+        if (!logRemove(key))
+            return false;
+
+        // If the table exists
+        if (table)
+        {
+            // Search for the key-value pair
+            for (auto current = table[hash], previous = current; current; current = current->collisionEntry)
+            {
+                // Key found
+                if (key == current->key)
+                {
+                    // If this pair is at the front of the Collision List
+                    if (table[hash] == current)
+                    {
+                        // Point table[hash] to current's next Entry
+                        table[hash] = current->collisionEntry;
+                    }
+
+                    // This value is at the end of the Collision List
+                    // or in the middle of the List
+                    else
+                    {
+                        // Point table[hash] to current's next Entry
+                        previous->collisionEntry = current->collisionEntry;
+                    }
+
+                    // The key leaves the Filter with its last Entry
+                    if (filter && !findEntry(current->collisionEntry, key))
+                        filter->remove(key);
+
+                    entries.destroy(current);
+                    return true;
+                }
+
+                // Assign previous to current
+                previous = current;
+            }
+        }
+        // No such key in the Table
+        return false;
+    }
+
+    // Clears the entire Table
+    // Entries that need no destructor aren't visited at all,
+    // their slabs are freed whole
+    // Returns -1, and clears nothing, if the log couldn't record it
+    int clear()
+    {
+        if (!logClear())
+            return -1;
+
+        int counter = entries.size();
+
+        // If the table exists
+        if (table)
+        {
+            destroyEntries(table, size);
+
+            for (int i = 0; i < size; i++)
+                table[i] = nullptr;
+        }
+
+        entries.release();
+
+        if (filter)
+            filter->clear();
+
+        return counter;
+    }
+
+    // Clears the entire Table, leaving the freeing to a background thread
+    // The Table gets new "buckets" and slabs at once, and
+    // the old ones are freed while the caller goes on
+    // Returns the number of Entries handed over,
+    // or -1 if the log couldn't record the clear
+    int clearAsync()
+    {
+        // A moved from Table has nothing to hand over
+        if (!table)
+            return clear();
+
+        // Everything that can fail comes first,
+        // before the Table gives anything up
+        freer.reserve();
+        Cleared *cleared = new Cleared(size);
+
+        if (!logClear())
+        {
+            delete cleared;
+            return -1;
+        }
+
+        int counter = entries.size();
+
+        // Trade the old "buckets" and slabs for empty ones
+        std::swap(table, cleared->table);
+        entries.swap(cleared->entries);
+
+        if (filter)
+            filter->clear();
+
+        freer.hand(cleared);
+
+        return counter;
+    }
+
+    // Loads the Table from a log file (and the snapshot it was
+    // last compacted into) and logs every put() and remove() after it.
+    // Records are synced every flushIntervalMs milliseconds,
+    // or on every mutation if flushIntervalMs is 0
+    bool openLog(const string &path, int flushIntervalMs = 5)
+    {
+        // The Table already has a log
+        if (log)
+            return false;
+
+        // Everything is loaded into a copy, so that the Table
+        // is left as it was if the snapshot or the log is broken
+        HashTable loaded(*this);
+
+        // Load the snapshot the log was last compacted into
+        uint64_t snapshotGeneration = 0;
+        ifstream snapshot(path + ".snapshot", ios::binary);
+
+        if (snapshot)
+        {
+            if (!snapshot.read((char *)&snapshotGeneration, sizeof(snapshotGeneration)) ||
+                !loaded.deserialize(snapshot))
+                return false;
+        }
+
+        snapshot.close();
+
+        // Replay the mutations logged since
+        WriteAheadLog *newLog = new WriteAheadLog();
+
+        if (!newLog->open(path, snapshotGeneration, flushIntervalMs,
+                          [&loaded](const char *cursor, const char *end)
+                          { return loaded.replayRecord(cursor, end); }))
+        {
+            delete newLog;
+            return false;
+        }
+
+        swap(loaded);
+
+        log = newLog;
+        return true;
+    }
+
+    // Waits until every logged mutation is on disk
+    bool syncLog()
+    {
+        return log && log->sync();
+    }
+
+    // Writes the Table to the log's snapshot and empties the log
+    bool compactLog()
+    {
+        if (!log || !log->sync())
+            return false;
+
+        uint64_t generation = log->getGeneration() + 1;
+        string snapshotPath = log->getPath() + ".snapshot";
+        string temporaryPath = snapshotPath + ".tmp";
+
+        // Write the new snapshot next to the old one
+        ofstream snapshot(temporaryPath, ios::binary | ios::trunc);
+
+        snapshot.write((const char *)&generation, sizeof(generation));
+        bool written = serialize(snapshot) && (snapshot.close(), !snapshot.fail());
+
+        // Make sure it's on disk before it replaces the old one
+        int fd = written ? open(temporaryPath.c_str(), O_RDONLY) : -1;
+        written = fd >= 0 && 0 == fsync(fd);
+
+        if (fd >= 0)
+            ::close(fd);
+
+        if (!written || 0 != rename(temporaryPath.c_str(), snapshotPath.c_str()))
+        {
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+
+        // From here on the snapshot holds every logged record
+        return log->startGeneration(generation);
+    }
+
+    // Syncs and closes the log
+    void closeLog()
+    {
+        if (log)
+        {
+            log->close();
+            delete log;
+            log = nullptr;
+        }
+    }
+
+    // Keeps a Filter of the keys, so that get() can
+    // skip the "buckets" for most missing keys
+    // expectedEntries is how many keys to make room for
+    void enableFilter(size_t expectedEntries = 64)
+    {
+        rebuildFilter(expectedEntries);
+    }
+
+    // Drops the Filter
+    void disableFilter()
+    {
+        delete filter;
+        filter = nullptr;
+    }
+
+    // Writes the Table to a snapshot file
+    // that openSnapshot() can map without deserializing
+    bool saveSnapshot(const string &path)
+    {
+        static_assert(is_trivially_copyable<K>::value && is_trivially_copyable<V>::value,
+                      "Snapshots need trivially copyable keys and values");
+        static_assert(alignof(SnapshotEntry<K, V>) <= alignof(uint64_t),
+                      "Snapshot Entries must not need more than 8-byte alignment");
+
+        // If the table doesn't exist
+        if (!table)
+            return false;
+
+        // Count the Entries in each "bucket"
+        // to find where each "bucket" starts
+        uint64_t *bucketOffsets = new uint64_t[size + 1];
+
+        bucketOffsets[0] = 0;
+        for (int i = 0; i < size; i++)
+        {
+            bucketOffsets[i + 1] = bucketOffsets[i];
+
+            for (auto current = table[i]; current; current = current->collisionEntry)
+                bucketOffsets[i + 1]++;
+        }
+
+        SnapshotHeader header;
+        memset(&header, 0, sizeof(header));
+
+        header.magic = SNAPSHOT_MAGIC;
+        header.keySize = sizeof(K);
+        header.valueSize = sizeof(V);
+        header.bucketCount = size;
+        header.entryCount = bucketOffsets[size];
+
+        // Write to a temporary file first so that a reader
+        // never maps a half written snapshot
+        string temporaryPath = path + ".tmp";
+        ofstream file(temporaryPath, ios::binary | ios::trunc);
+
+        file.write((const char *)&header, sizeof(header));
+        file.write((const char *)bucketOffsets, sizeof(uint64_t) * (size + 1));
+
+        delete[] bucketOffsets;
+
+        // Write the Entries "bucket" by "bucket"
+        // keeping the order of each Collision List,
+        // a block of Entries per write instead of one
+        vector<SnapshotEntry<K, V>> block(SNAPSHOT_BLOCK_ENTRIES);
+        memset((void *)block.data(), 0, block.size() * sizeof(SnapshotEntry<K, V>));
+
+        size_t filled = 0;
+
+        for (int i = 0; i < size && file; i++)
+        {
+            for (auto current = table[i]; current; current = current->collisionEntry)
+            {
+                block[filled].key = current->key;
+                block[filled].value = current->value;
+
+                if (++filled == block.size())
+                {
+                    file.write((const char *)block.data(), filled * sizeof(SnapshotEntry<K, V>));
+                    filled = 0;
+                }
+            }
+        }
+
+        file.write((const char *)block.data(), filled * sizeof(SnapshotEntry<K, V>));
+
+        file.close();
+
+        // Make sure it's on disk before it replaces the old one,
+        // or a crash could leave an empty file under path
+        bool written = !file.fail();
+        int fd = written ? open(temporaryPath.c_str(), O_RDONLY) : -1;
+        written = fd >= 0 && 0 == fsync(fd);
+
+        if (fd >= 0)
+            ::close(fd);
+
+        if (!written || 0 != rename(temporaryPath.c_str(), path.c_str()))
+        {
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    // Maps a snapshot file written by saveSnapshot()
+    // Returns nullptr if the file is not a valid snapshot
+    static HashTableSnapshot<K, V> *openSnapshot(const string &path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+
+        // No such file
+        if (fd < 0)
+            return nullptr;
+
+        struct stat status;
+        if (fstat(fd, &status) < 0 || (size_t)status.st_size < sizeof(SnapshotHeader))
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        size_t length = status.st_size;
+        void *mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+
+        // The mapping stays valid after the file is closed
+        ::close(fd);
+
+        if (MAP_FAILED == mapping)
+            return nullptr;
+
+        // Check that the snapshot was written for this K and V
+        // and that the file holds everything the header promises
+        // The counts come from the file, so they are checked against
+        // what is left of it instead of multiplied out (which can wrap)
+        const SnapshotHeader *header = (const SnapshotHeader *)mapping;
+        size_t left = length - sizeof(SnapshotHeader);
+
+        bool valid = SNAPSHOT_MAGIC == header->magic &&
+                     sizeof(K) == header->keySize &&
+                     sizeof(V) == header->valueSize &&
+                     0 != header->bucketCount &&
+                     header->bucketCount < left / sizeof(uint64_t);
+
+        if (valid)
+        {
+            left -= sizeof(uint64_t) * (header->bucketCount + 1);
+
+            valid = 0 == left % sizeof(SnapshotEntry<K, V>) &&
+                    header->entryCount == left / sizeof(SnapshotEntry<K, V>);
+        }
+
+        // Every "bucket" must start where the last one ends,
+        // and the last one must end at the last Entry
+        const uint64_t *bucketOffsets = (const uint64_t *)(header + 1);
+
+        for (uint64_t i = 0; valid && i < header->bucketCount; i++)
+            valid = bucketOffsets[i] <= bucketOffsets[i + 1];
+
+        if (!valid || 0 != bucketOffsets[0] || header->entryCount != bucketOffsets[header->bucketCount])
+        {
+            munmap(mapping, length);
+            return nullptr;
+        }
+
+        return new HashTableSnapshot<K, V>(mapping, length);
+    }
+
+    // Writes the Table to a stream in binary chunks
+    bool serialize(ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, TABLE_MAGIC, checksummed);
+
+        // Holds a Collision List so that it can be written
+        // oldest Entry first, put() puts it back in the same order
+        vector<Entry<K, V> *> chain;
+
+        // Trivially copyable keys and values are laid out in a batch,
+        // which is added to the stream a chunk at a time
+        constexpr bool BULK = is_trivially_copyable<K>::value && is_trivially_copyable<V>::value;
+        const size_t RECORD_SIZE = sizeof(K) + sizeof(V);
+        string batch;
+
+        // If the table exists
+        if (table)
+        {
+            for (int i = 0; i < size; i++)
+            {
+                if constexpr (BULK)
+                {
+                    size_t length = 0;
+
+                    for (auto current = table[i]; current; current = current->collisionEntry)
+                        length++;
+
+                    // Lay the Collision List out from the back of its room
+                    batch.resize(batch.size() + length * RECORD_SIZE);
+                    char *record = &batch[0] + batch.size();
+
+                    for (auto current = table[i]; current; current = current->collisionEntry)
+                    {
+                        record -= RECORD_SIZE;
+
+                        memcpy(record, &current->key, sizeof(K));
+                        memcpy(record + sizeof(K), &current->value, sizeof(V));
+                    }
+
+                    if (batch.size() >= SERIALIZE_CHUNK_SIZE)
+                    {
+                        writer.writeRecords(batch.data(), batch.size() / RECORD_SIZE, RECORD_SIZE);
+                        batch.clear();
+                    }
+                }
+                else
+                {
+                    chain.clear();
+
+                    for (auto current = table[i]; current; current = current->collisionEntry)
+                        chain.push_back(current);
+
+                    for (auto entry = chain.rbegin(); entry != chain.rend(); entry++)
+                    {
+                        writer.write((*entry)->key);
+                        writer.write((*entry)->value);
+                        writer.endRecord();
+                    }
+                }
+            }
+        }
+
+        writer.writeRecords(batch.data(), batch.size() / RECORD_SIZE, RECORD_SIZE);
+
+        return writer.finish();
+    }
+
+    // Reads Entries written by serialize()
+    // and adds them to the Table
+    bool deserialize(istream &in)
+    {
+        ChunkReader reader(in, TABLE_MAGIC);
+        K key;
+        V value;
+
+        while (reader.nextRecord() && reader.read(key) && reader.read(value))
+            put(key, value);
+
+        return reader.succeeded();
+    }
+
+    // Calls function(key, value) for every Entry
+    template <class Function>
+    void forEach(Function function)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            for (auto current = table[i]; current; current = current->collisionEntry)
+                function((const K &)current->key, current->value);
+        }
+    }
+
+    // Calls function(key, value) for every Entry, on several threads
+    // Each thread walks its own ranges of "buckets", so function
+    // may change the value, but no thread may change the Table
+    template <class Function>
+    void forEachParallel(Function function)
+    {
+        int chunks = (size + PARALLEL_CHUNK_BUCKETS - 1) / PARALLEL_CHUNK_BUCKETS;
+
+        parallelFor(chunks, [&](int chunk)
+                    {
+            int last = min(size, (chunk + 1) * PARALLEL_CHUNK_BUCKETS);
+
+            for (int i = chunk * PARALLEL_CHUNK_BUCKETS; i < last; i++)
+            {
+                for (auto current = table[i]; current; current = current->collisionEntry)
+                    function((const K &)current->key, current->value);
+            } });
+    }
+
+    // Returns identity combine()d with map(key, value) of every Entry,
+    // computed on several threads
+    // combine() must be associative and identity must leave a value
+    // unchanged, since each range of "buckets" starts from identity
+    template <class T, class Map, class Combine>
+    T reduceParallel(T identity, Map map, Combine combine)
+    {
+        int chunks = (size + PARALLEL_CHUNK_BUCKETS - 1) / PARALLEL_CHUNK_BUCKETS;
+
+        return parallelReduce(chunks, identity, [&](int chunk)
+                              {
+            T result = identity;
+            int last = min(size, (chunk + 1) * PARALLEL_CHUNK_BUCKETS);
+
+            for (int i = chunk * PARALLEL_CHUNK_BUCKETS; i < last; i++)
+            {
+                for (auto current = table[i]; current; current = current->collisionEntry)
+                    result = combine(result, map((const K &)current->key, (const V &)current->value));
+            }
+
+            return result; }, combine);
+    }
+
+    // Returns the number of Entries for which predicate(key, value) holds
+    template <class Predicate>
+    long countIf(Predicate predicate)
+    {
+        return reduceParallel(0L, [&](const K &key, const V &value)
+                              { return predicate(key, value) ? 1L : 0L; }, plus<long>());
+    }
+
+    // Returns the bytes held by the Table, counting every
+    // slab (but not memory the keys and values hold themselves)
+    size_t memoryUsage()
+    {
+        size_t bytes = sizeof(*this) + size * sizeof(Entry<K, V> *) + entries.memoryUsage();
+
+        if (filter)
+            bytes += sizeof(*filter) + filter->capacity() * sizeof(uint16_t);
+
+        return bytes;
+    }
+
+    // Writes every Entry to a stream, "bucket" by "bucket"
+    bool dump(ostream &out, DumpFormat format = DUMP_TEXT)
+    {
+        DumpWriter writer(out, format, dumpBuffer);
+
+        for (int i = 0; i < size; i++)
+        {
+            writer.beginBucket(i);
+
+            for (auto current = table[i]; current; current = current->collisionEntry)
+                writer.entry(current->key, current->value, current->collisionEntry);
+
+            writer.endBucket();
+        }
+
+        return writer.finish();
+    }
+
+    // Prints the entire Hash Table
+    void printTable()
+    {
+        cout << "\n";
+        dump(cout);
+    }
+};
+
+// A HashTable that keeps every value put() under a key
+template <class K, class V>
+using HashMultiMap = HashTable<K, V, true>;
+
+// A 16 byte value
+struct Span
+{
+    long start;
+    long length;
+};
+
+// Times copying and serializing a HashTable of n trivially copyable
+// Entries, against copying the same Entries one by one and writing
+// them a record at a time
+template <class V>
+void fastPathsAgainstEntries(int n)
+{
+    HashTable<int, V> original(n), removed(n);
+    V value;
+
+    memset((void *)&value, 0, sizeof(value));
+
+    for (int i = 0; i < n; i++)
+    {
+        original.put(i, value);
+        removed.put(i, value);
+    }
+
+    // A Table with a removed Entry has a free Slot,
+    // so it can only be copied Entry by Entry
+    removed.put(n, value);
+    removed.remove(n);
+
+    auto start = chrono::steady_clock::now();
+    HashTable<int, V> copy(original);
+    auto copying = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    HashTable<int, V> removedCopy(removed);
+    auto copyingEntries = chrono::steady_clock::now() - start;
+
+    stringstream bulk, records;
+
+    start = chrono::steady_clock::now();
+    original.serialize(bulk);
+    auto serializing = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    ChunkWriter writer(records, TABLE_MAGIC, false);
+
+    original.forEach([&](const int &key, V &value)
+                     {
+        writer.write(key);
+        writer.write(value);
+        writer.endRecord(); });
+    writer.finish();
+
+    auto writingRecords = chrono::steady_clock::now() - start;
+
+    long copied = 0;
+
+    copy.forEach([&](const int &, V &)
+                 { copied++; });
+
+    cout << "copy : " << chrono::duration_cast<chrono::microseconds>(copying).count() << " us, Entry by Entry : "
+         << chrono::duration_cast<chrono::microseconds>(copyingEntries).count() << " us, serialize() : "
+         << chrono::duration_cast<chrono::microseconds>(serializing).count() << " us, record by record : "
+         << chrono::duration_cast<chrono::microseconds>(writingRecords).count() << " us ("
+         << (copied == n && bulk.str() == records.str()) << ")" << endl;
+}
+
+// Times n get()s, 9 in 10 of them for missing keys, on a Table
+// of n Entries with a Filter, against the same Table without one
+void filterAgainstBuckets(int n)
+{
+    HashTable<string, int> plain(n);
+    HashTable<string, int> filtered(n);
+    filtered.enableFilter(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        plain.put("key" + to_string(i), i);
+        filtered.put("key" + to_string(i), i);
+    }
+
+    vector<string> lookups;
+    for (int i = 0; i < n; i++)
+        lookups.push_back((i % 10 ? "miss" : "key") + to_string(i));
+
+    long micros[2], found[2] = {0, 0};
+    HashTable<string, int> *tables[2] = {&plain, &filtered};
+
+    for (int i = 0; i < 2; i++)
+    {
+        auto start = chrono::steady_clock::now();
+
+        for (auto &key : lookups)
+        {
+            int value;
+            found[i] += tables[i]->get(key, value);
+        }
+
+        micros[i] = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    }
+
+    cout << n << " miss-heavy get()s, no Filter : " << micros[0] << " us, Filter : "
+         << micros[1] << " us (" << (found[0] == found[1]) << ")" << endl;
+
+    plain.clear();
+    filtered.clear();
+}
+
+// Times n durable put()s with the log synced in batches every
+// 5 ms (group commit), against syncing it on every put()
+void groupCommitAgainstSyncs(int n)
+{
+    long micros[2];
+    int intervals[2] = {5, 0};
+
+    for (int i = 0; i < 2; i++)
+    {
+        HashTable<int, int> table(n);
+
+        if (!table.openLog("durable.log", intervals[i]))
+            return;
+
+        auto start = chrono::steady_clock::now();
+
+        for (int j = 0; j < n; j++)
+            table.put(j, j);
+
+        // Every put() is on disk once syncLog() returns
+        table.syncLog();
+        micros[i] = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+        table.closeLog();
+        std::remove("durable.log");
+        std::remove("durable.log.snapshot");
+    }
+
+    cout << n << " durable put()s, group commit : " << micros[0] << " us, sync per put() : "
+         << micros[1] << " us" << endl;
+}
+
+// Times getting a Table of n Entries ready to serve at startup :
+// mapping its snapshot file, against deserializing it into a new Table
+void startupAgainstRebuild(int n)
+{
+    HashTable<int, int> original(n);
+
+    for (int i = 0; i < n; i++)
+        original.put(i, i * 3);
+
+    ofstream file("startup.bin", ios::binary | ios::trunc);
+    bool saved = original.saveSnapshot("startup.snapshot") && original.serialize(file);
+    file.close();
+
+    auto start = chrono::steady_clock::now();
+    HashTableSnapshot<int, int> *snapshot = HashTable<int, int>::openSnapshot("startup.snapshot");
+    auto mapping = chrono::steady_clock::now() - start;
+
+    ifstream in("startup.bin", ios::binary);
+    start = chrono::steady_clock::now();
+
+    HashTable<int, int> rebuilt(n);
+    bool loaded = rebuilt.deserialize(in);
+
+    auto rebuilding = chrono::steady_clock::now() - start;
+
+    int value = 0;
+
+    cout << "openSnapshot() : " << chrono::duration_cast<chrono::microseconds>(mapping).count() << " us, "
+         << "deserialize() : " << chrono::duration_cast<chrono::microseconds>(rebuilding).count() << " us ("
+         << (saved && loaded && snapshot && snapshot->get(n - 1, value) && value == (n - 1) * 3) << ")" << endl;
+
+    delete snapshot;
+    in.close();
+
+    std::remove("startup.snapshot");
+    std::remove("startup.bin");
+}
+
+// Times writing a Table of n Entries to a file the way printTable()
+// used to, a string and a flush per line, against dump()
+void dumpAgainstConcatenation(int n)
+{
+    HashTable<string, string> large(n);
+
+    for (int i = 0; i < n; i++)
+        large.put("key" + to_string(i), to_string(i * 7));
+
+    ofstream file("dump.txt");
+    auto start = chrono::steady_clock::now();
+
+    int line = 0;
+
+    large.forEach([&](const string &key, string &value)
+                  {
+        string output = "[" + to_string(line++) + "] => ";
+        output += ("[" + key + " : " + value + "] ");
+
+        file << output << endl; });
+
+    auto concatenating = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    large.dump(file);
+
+    auto dumping = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    large.dump(file, DUMP_JSON);
+
+    auto json = chrono::steady_clock::now() - start;
+
+    cout << "Concatenation : " << chrono::duration_cast<chrono::microseconds>(concatenating).count() << " us, "
+         << "dump() : " << chrono::duration_cast<chrono::microseconds>(dumping).count() << " us, "
+         << "as JSON : " << chrono::duration_cast<chrono::microseconds>(json).count() << " us" << endl;
+
+    file.close();
+    std::remove("dump.txt");
+    large.clear();
+}
+
+// Sums and counts values of a Table of n Entries serially,
+// then in parallel
+void aggregateInParallel(int n)
+{
+    HashTable<int, int> large(1 << 20);
+
+    for (int i = 0; i < n; i++)
+        large.put(i, i % 1000);
+
+    long serialSum = 0, serialEven = 0;
+    auto start = chrono::steady_clock::now();
+
+    large.forEach([&](const int &, int &value)
+                  { serialSum += value; serialEven += value % 2 == 0; });
+
+    auto serial = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    long sum = large.reduceParallel(0L, [](const int &, const int &value)
+                                    { return (long)value; }, plus<long>());
+    long even = large.countIf([](const int &, const int &value)
+                              { return value % 2 == 0; });
+
+    auto parallel = chrono::steady_clock::now() - start;
+
+    cout << "Serial : " << chrono::duration_cast<chrono::microseconds>(serial).count() << " us, "
+         << "parallel on " << parallelThreads() << " threads : "
+         << chrono::duration_cast<chrono::microseconds>(parallel).count() << " us ("
+         << (sum == serialSum && even == serialEven) << ")" << endl;
+
+    large.forEachParallel([](const int &, int &value)
+                          { value++; });
+    cout << large.countIf([](const int &, const int &value)
+                          { return value == 1000; })
+         << endl;
+
+    large.clear();
+}
+
+int main()
+{
+    // Create new Hash Table
+    HashTable<string, string> table;
+
+    table.put("adam", "19");
+    table.put("eve", "22");
+    table.put("john", "4");
+    table.put("doe", "87");
+
+    table.printTable();
+
+    // Dump it for other tools to read
+    table.dump(cout, DUMP_JSON);
+    table.dump(cout, DUMP_CSV);
+
+    // Round trip the Table through a binary stream
+    stringstream stream;
+    table.serialize(stream, true);
+
+    HashTable<string, string> copy;
+    copy.deserialize(stream);
+    copy.printTable();
+
+    string result;
+    if (table.get("adam", result))
+        cout << result << endl;
+
+    // Tables are values : copies are deep, moves are O(1)
+    vector<HashTable<string, string>> tables;
+    tables.push_back(copy);
+    tables.push_back(std::move(copy));
+
+    tables[0].remove("eve");
+    cout << tables[0].get("eve", result) << " " << tables[1].get("eve", result) << endl;
+
+    copy = tables[1];
+    copy.clear();
+
+    table.remove("adam");
+    cout << table.get("adam", result) << endl;
+
+    cout << table.clear() << endl;
+
+    // Snapshot an int Table and read it back through mmap
+    HashTable<int, int> squares;
+
+    for (int i = 0; i < 20; i++)
+        squares.put(i, i * i);
+
+    if (squares.saveSnapshot("squares.snapshot"))
+    {
+        HashTableSnapshot<int, int> *snapshot = HashTable<int, int>::openSnapshot("squares.snapshot");
+
+        int square;
+        if (snapshot && snapshot->get(7, square))
+            cout << square << endl;
+
+        delete snapshot;
+        std::remove("squares.snapshot");
+    }
+
+    squares.clear();
+
+    // Keep a Table in a write-ahead log, then load it back
+    HashTable<string, string> ages;
+
+    if (ages.openLog("ages.log"))
+    {
+        ages.put("adam", "19");
+        ages.put("eve", "22");
+        ages.compactLog();
+
+        ages.put("john", "4");
+        ages.remove("adam");
+        ages.closeLog();
+
+        HashTable<string, string> restored;
+        restored.openLog("ages.log");
+
+        cout << restored.get("adam", result) << " ";
+        if (restored.get("john", result))
+            cout << result << endl;
+
+        restored.closeLog();
+        restored.clear();
+
+        std::remove("ages.log");
+        std::remove("ages.log.snapshot");
+    }
+
+    ages.clear();
+
+    // Syncing the log in batches, against on every put()
+    groupCommitAgainstSyncs(2000);
+
+    // Let a Filter answer for missing keys
+    HashTable<int, int> cubes;
+    cubes.enableFilter(1000);
+
+    for (int i = 0; i < 1000; i++)
+        cubes.put(i, i * i * i);
+
+    cubes.remove(10);
+
+    int cube;
+    cout << cubes.get(10, cube) << " " << cubes.get(5000, cube) << " ";
+    if (cubes.get(9, cube))
+        cout << cube << endl;
+
+    cubes.clear();
+
+    // Mostly missing keys, with and without a Filter
+    filterAgainstBuckets(200000);
+
+    // A Filter can also be used on its own
+    CuckooFilter<string> seen(100);
+
+    seen.add("adam");
+    seen.add("eve");
+
+    stringstream filterStream;
+    seen.serialize(filterStream);
+
+    CuckooFilter<string> loaded;
+    if (loaded.deserialize(filterStream))
+        cout << loaded.mayContain("eve") << " " << loaded.mayContain("john") << " " << loaded.size() << endl;
+
+    // Every Entry is allocated on its own (CompactHashTable.cpp
+    // has a Table that packs them)
+    HashTable<int, int> loose(1 << 16);
+
+    for (int i = 0; i < 100000; i++)
+        loose.put(i, i);
+
+    cout << "Bytes per Entry : " << loose.memoryUsage() / 100000.0 << endl;
+    loose.clear();
+
+    // Counting words changes the same few Entries over and over
+    HashTable<int, int> counts;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        if (!counts.update(i % 1000, [](int &count) { count++; }))
+            counts.tryEmplace(i % 1000, 1);
+    }
+
+    auto updating = chrono::steady_clock::now() - start;
+
+    // The same counts as one Entry per put(), the way put() used to
+    // add them (a lookup, then a new Entry in front of the old ones)
+    HashMultiMap<int, int> pile;
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        int count = 0;
+        pile.get(i % 1000, count);
+        pile.put(i % 1000, count + 1);
+    }
+
+    auto piling = chrono::steady_clock::now() - start;
+
+    int count = 0;
+    counts.get(7, count);
+
+    cout << "update() : " << chrono::duration_cast<chrono::milliseconds>(updating).count() << " ms, "
+         << "new Entries : " << chrono::duration_cast<chrono::milliseconds>(piling).count() << " ms ("
+         << count << " " << pile.count(7) << ")" << endl;
+
+    counts.clear();
+    pile.clear();
+
+    // A key can have many values in a HashMultiMap
+    HashMultiMap<string, string> authors;
+
+    authors.put("C", "Dennis");
+    authors.put("C++", "Bjarne");
+    authors.put("C", "Brian");
+
+    for (auto range = authors.equalRange("C"); range.first != range.second; ++range.first)
+        cout << range.first.key() << " : " << range.first.value() << endl;
+
+    authors.insertOrAssign("C++", "Stroustrup");
+    cout << authors.count("C") << " " << authors.count("C++") << endl;
+
+    // Tearing down a big Table : ints need no destructor, so clear()
+    // only frees slabs, and clearAsync() hands even that to a thread
+    HashTable<int, int> big(1 << 20);
+    HashTable<int, string> names(1 << 20);
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        big.put(i, i);
+        names.put(i, "name");
+    }
+
+    start = chrono::steady_clock::now();
+    int cleared = big.clear();
+    auto clearing = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    cleared += names.clear();
+    auto destroying = chrono::steady_clock::now() - start;
+
+    for (int i = 0; i < 1000000; i++)
+        names.put(i, "name");
+
+    start = chrono::steady_clock::now();
+    cleared += names.clearAsync();
+    auto detaching = chrono::steady_clock::now() - start;
+
+    cout << "clear() of ints : " << chrono::duration_cast<chrono::microseconds>(clearing).count() << " us, "
+         << "of strings : " << chrono::duration_cast<chrono::microseconds>(destroying).count() << " us, "
+         << "clearAsync() : " << chrono::duration_cast<chrono::microseconds>(detaching).count() << " us ("
+         << cleared << ")" << endl;
+
+    // A HashTable of trivially copyable Entries is copied slab by
+    // slab and serialized in batches
+    cout << "HashTable of ints : ";
+    fastPathsAgainstEntries<int>(1000000);
+
+    cout << "HashTable of Spans : ";
+    fastPathsAgainstEntries<Span>(1000000);
+
+    // Aggregate a big Table serially and on every core
+    aggregateInParallel(2000000);
+
+    // Dump a big Table
+    dumpAgainstConcatenation(1000000);
+
+    // Start serving a big Table from a snapshot, or by rebuilding it
+    startupAgainstRebuild(1000000);
 
     return 0;
 }
\ No newline at end of file
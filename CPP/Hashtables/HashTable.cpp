@@ -9,14 +9,35 @@
  * --------------------------------------------------------------------------------
  *
  * Revision History :
+ * 2026-October-19	[AG] : A moved from container is empty and usable
+ * 2026-October-19	[AG] : Chunked streams come from ChunkStream.h
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Added CounterTable for counters shared by threads
+ * 2026-October-19	[AG] : Added serialize() and deserialize()
  * 2020-August-08	[SP] : Created
  * --------------------------------------------------------------------------------
  */
 
 #include <iostream>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <unordered_map>
+
+#include "../Serialization/ChunkStream.h"
 
 using namespace std;
 
+// Marks the start of a serialized Hash Table ("HTB1")
+const uint32_t TABLE_MAGIC = 0x31425448;
+
 // Represents a value in the Hash Table
 struct Entry
 {
@@ -57,6 +78,31 @@ class HashTable
         return key % size;
     }
 
+    // Deletes every Entry, returns how many there were
+    int deleteEntries()
+    {
+        int counter = 0;
+
+        // If the table exists
+        if (table)
+        {
+            // Clear each bucket
+            for (int i = 0; i < size; i++)
+            {
+                for (Entry *current = table[i]; current; current = table[i])
+                {
+                    // Point table[hash] to the next Entry after current
+                    table[i] = current->collisionEntry;
+
+                    delete current;
+                    counter++;
+                }
+            }
+        }
+
+        return counter;
+    }
+
 public:
     // Parameterised Constructor
     HashTable(int initialSize = 11)
@@ -69,6 +115,58 @@ public:
             table[i] = nullptr;
     }
 
+    // Copy Constructor
+    // The copy gets Entries of its own, in the same order
+    HashTable(const HashTable &other) : HashTable(other.table ? other.size : 11)
+    {
+        for (int i = 0; other.table && i < size; i++)
+        {
+            // Holds the link to point at the next copied Entry
+            Entry **link = &table[i];
+
+            for (Entry *current = other.table[i]; current; current = current->collisionEntry)
+            {
+                *link = new Entry(current->key, current->value);
+                link = &(*link)->collisionEntry;
+            }
+        }
+    }
+
+    // Move Constructor
+    // Takes other's "buckets" in O(1)
+    // other is left empty, and only gets "buckets" again on its next put()
+    HashTable(HashTable &&other) noexcept
+    {
+        table = other.table;
+        size = other.size;
+
+        other.table = nullptr;
+        other.size = 0;
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the Table moved from),
+    // so its Entries are taken and ours go away with it
+    HashTable &operator=(HashTable other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~HashTable()
+    {
+        deleteEntries();
+        delete[] table;
+    }
+
+    // Trades Entries with another Table
+    void swap(HashTable &other) noexcept
+    {
+        std::swap(table, other.table);
+        std::swap(size, other.size);
+    }
+
     // Adds a value to the Table
     void put(int key, int value)
     {
@@ -79,6 +177,10 @@ public:
         if (!(newEntry = new Entry(key, value)))
             return;
 
+        // A moved from Table needs "buckets" again
+        if (!table)
+            table = new Entry *[(size = 11)]();
+
         // Get the hash of the key
         int hash = getHash(key);
 
@@ -96,6 +198,10 @@ public:
     // Returns the value of the a given key
     int get(int key)
     {
+        // A moved from Table has no "buckets"
+        if (!table)
+            return 0;
+
         // Get the hash of the key
         int hash = getHash(key);
 
@@ -115,6 +221,51 @@ public:
         return 0;
     }
 
+    // Writes the Table to a stream in binary chunks
+    bool serialize(ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, TABLE_MAGIC, checksummed);
+
+        // Holds a Collision List so that it can be written
+        // oldest Entry first, put() puts it back in the same order
+        vector<Entry *> chain;
+
+        // If the table exists
+        if (table)
+        {
+            for (int i = 0; i < size; i++)
+            {
+                chain.clear();
+
+                for (auto current = table[i]; current; current = current->collisionEntry)
+                    chain.push_back(current);
+
+                for (auto entry = chain.rbegin(); entry != chain.rend(); entry++)
+                {
+                    writer.write((*entry)->key);
+                    writer.write((*entry)->value);
+                    writer.endRecord();
+                }
+            }
+        }
+
+        return writer.finish();
+    }
+
+    // Reads Entries written by serialize()
+    // and adds them to the Table
+    bool deserialize(istream &in)
+    {
+        ChunkReader reader(in, TABLE_MAGIC);
+        int key;
+        int value;
+
+        while (reader.nextRecord() && reader.read(key) && reader.read(value))
+            put(key, value);
+
+        return reader.succeeded();
+    }
+
     // Prints the entire Hash Table
     void printTable()
     {
@@ -145,12 +296,12 @@ public:
     // Removes a key-value pair from the Table
     bool remove(int key)
     {
-        // Get the hash of the key
-        int hash = getHash(key);
-
         // If the table is not empty
         if (table)
         {
+            // Get the hash of the key
+            int hash = getHash(key);
+
             // Search for the Entry with the given key
             for (Entry *current = table[hash], *previous = current; current; current = current->collisionEntry)
             {
@@ -188,33 +339,305 @@ public:
     // Clears the Table
     void clear()
     {
-        int counter = 0;
+        int counter = deleteEntries();
 
-        // If the table exists
-        if (table)
+        cout << "Table cleared. Deleted " << counter << " Entries." << endl;
+    }
+};
+
+// Holds the share of a counter added to by some of the threads
+// Each one fills a cache line, so that threads adding to
+// different stripes don't fight over the same line
+struct alignas(64) CounterStripe
+{
+    atomic<long> value;
+};
+
+// The number of stripes a sharded counter is split into
+const int COUNTER_STRIPES = 16;
+
+// Returns the stripe the calling thread adds to
+int stripeIndex()
+{
+    static atomic<int> threads(0);
+    thread_local int index = threads.fetch_add(1, memory_order_relaxed) % COUNTER_STRIPES;
+
+    return index;
+}
+
+// Represents a counter in the Counter Table
+struct CounterEntry
+{
+    // Holds the key of the Entry
+    int key;
+
+    // Holds the count
+    atomic<long> value;
+
+    // Points to the stripes, once the counter is sharded
+    atomic<CounterStripe *> stripes;
+
+    // Points to the collision Entry
+    // It never changes once the Entry is in the Table
+    CounterEntry *collisionEntry;
+
+    // Constructor
+    CounterEntry(int k)
+    {
+        key = k;
+        value.store(0, memory_order_relaxed);
+        stripes.store(nullptr, memory_order_relaxed);
+        collisionEntry = nullptr;
+    }
+
+    // Destructor
+    ~CounterEntry()
+    {
+        delete[] stripes.load(memory_order_relaxed);
+    }
+};
+
+// Represents a Table of counters that many threads add to at once
+//
+// Entries are only ever added, at the head of a "bucket" with a
+// compare-exchange, and the Table never grows, so an Entry
+// never moves or goes away while threads are using it.
+// Once a key is there, increment() is one atomic add and takes no lock
+class CounterTable
+{
+    // Points to the "buckets"
+    atomic<CounterEntry *> *table;
+
+    // Holds the size of the Table
+    int size;
+
+    // Holds the number of keys
+    atomic<int> count;
+
+    // Returns the hash of a key
+    int getHash(int key)
+    {
+        // Simple Hash Function
+        // (unsigned, so that negative keys land in the Table too)
+        return (unsigned)key % size;
+    }
+
+    // Returns the Entry of a key, nullptr if there is none
+    CounterEntry *find(int key)
+    {
+        for (CounterEntry *current = table[getHash(key)].load(memory_order_acquire); current; current = current->collisionEntry)
         {
-            // Clear each bucket
-            for (int i = 0; i < size; i++)
+            // Key found
+            if (current->key == key)
+                return current;
+        }
+
+        return nullptr;
+    }
+
+    // Returns the Entry of a key, adding it if there is none
+    CounterEntry *findOrAdd(int key)
+    {
+        int hash = getHash(key);
+        CounterEntry *head = table[hash].load(memory_order_acquire);
+        CounterEntry *newEntry = nullptr;
+
+        while (true)
+        {
+            // Another thread may have just added the key
+            for (CounterEntry *current = head; current; current = current->collisionEntry)
             {
-                for (Entry *current = table[i]; current; current = table[i])
+                if (current->key == key)
                 {
-                    // If there are no Entries in a bucket
-                    if (!table[i])
-                        continue;
+                    delete newEntry;
+                    return current;
+                }
+            }
 
-                    // Else point table[hash] to the next Entry after current
-                    table[i] = current->collisionEntry;
+            if (!newEntry)
+                newEntry = new CounterEntry(key);
 
-                    delete current;
-                    counter++;
-                }
+            // Add newEntry at the head of the Collision List,
+            // unless the head changed since it was searched
+            newEntry->collisionEntry = head;
+
+            if (table[hash].compare_exchange_weak(head, newEntry, memory_order_release, memory_order_acquire))
+            {
+                count.fetch_add(1, memory_order_relaxed);
+                return newEntry;
             }
         }
+    }
 
-        cout << "Table cleared. Deleted " << counter << " Entries." << endl;
+    // Returns the counter of an Entry, stripes and all
+    long total(CounterEntry *entry)
+    {
+        long value = entry->value.load(memory_order_relaxed);
+
+        if (CounterStripe *stripes = entry->stripes.load(memory_order_acquire))
+        {
+            for (int i = 0; i < COUNTER_STRIPES; i++)
+                value += stripes[i].value.load(memory_order_relaxed);
+        }
+
+        return value;
+    }
+
+public:
+    // Parameterised Constructor
+    // The Table never grows, so size it for the keys expected
+    CounterTable(int initialSize = 1021)
+    {
+        table = new atomic<CounterEntry *>[this->size = initialSize];
+
+        for (int i = 0; i < size; i++)
+            table[i].store(nullptr, memory_order_relaxed);
+
+        count.store(0, memory_order_relaxed);
+    }
+
+    // Threads may still be using the Table, so it can't be copied
+    CounterTable(const CounterTable &) = delete;
+    CounterTable &operator=(const CounterTable &) = delete;
+
+    // Destructor
+    // No other thread may be using the Table by now
+    ~CounterTable()
+    {
+        clear();
+        delete[] table;
+    }
+
+    // Adds delta to the counter of a key (which starts at 0)
+    // Returns the counter before the add
+    long increment(int key, long delta = 1)
+    {
+        return findOrAdd(key)->value.fetch_add(delta, memory_order_relaxed);
+    }
+
+    // Adds delta to the counter of a key, in the calling thread's stripe
+    //
+    // For keys so hot that even one atomic add is fought over :
+    // threads add to different cache lines, and get() sums the
+    // stripes up. Nothing is returned, as no thread sees the total
+    void incrementSharded(int key, long delta = 1)
+    {
+        CounterEntry *entry = findOrAdd(key);
+        CounterStripe *stripes = entry->stripes.load(memory_order_acquire);
+
+        // The first sharded add makes the stripes
+        if (!stripes)
+        {
+            CounterStripe *newStripes = new CounterStripe[COUNTER_STRIPES];
+
+            for (int i = 0; i < COUNTER_STRIPES; i++)
+                newStripes[i].value.store(0, memory_order_relaxed);
+
+            // Another thread may have made them first
+            if (entry->stripes.compare_exchange_strong(stripes, newStripes, memory_order_acq_rel, memory_order_acquire))
+                stripes = newStripes;
+            else
+                delete[] newStripes;
+        }
+
+        stripes[stripeIndex()].value.fetch_add(delta, memory_order_relaxed);
+    }
+
+    // Gets the counter of a key, stripes and all
+    // Adds made while reading may or may not be counted
+    bool get(int key, long &value)
+    {
+        CounterEntry *entry = find(key);
+
+        // No such key in the Table
+        if (!entry)
+            return false;
+
+        value = total(entry);
+        return true;
+    }
+
+    // Returns the number of keys
+    int keys()
+    {
+        return count.load(memory_order_relaxed);
+    }
+
+    // Prints the entire Counter Table
+    void printTable()
+    {
+        string output = "\n";
+
+        // Print the Entries is each "bucket"
+        for (int i = 0; i < size; i++)
+        {
+            CounterEntry *head = table[i].load(memory_order_acquire);
+
+            // Skip the empty "buckets", the Table is big
+            if (!head)
+                continue;
+
+            output += ("[" + to_string(i) + "] => ");
+
+            for (auto current = head; current; current = current->collisionEntry)
+            {
+                output += ("[" + to_string(current->key) + " : " + to_string(total(current)) + "] ");
+
+                if (current->collisionEntry)
+                    output += " => ";
+            }
+
+            cout << output << endl;
+            output = "";
+        }
+    }
+
+    // Clears the Table
+    // No other thread may be using the Table
+    int clear()
+    {
+        int counter = 0;
+
+        for (int i = 0; i < size; i++)
+        {
+            for (CounterEntry *current = table[i].exchange(nullptr), *next; current; current = next)
+            {
+                next = current->collisionEntry;
+
+                delete current;
+                counter++;
+            }
+        }
+
+        count.store(0, memory_order_relaxed);
+
+        return counter;
     }
 };
 
+// Lets threads add to counters at once, spread over keys
+// (a single key if keys is 1) and returns the time taken, in milliseconds
+template <class Increment>
+long hammer(int threads, int operations, int keys, Increment increment)
+{
+    vector<thread> workers;
+
+    auto start = chrono::steady_clock::now();
+
+    for (int t = 0; t < threads; t++)
+    {
+        workers.push_back(thread([=]
+                                 {
+            for (int i = 0; i < operations; i++)
+                increment((i * 31 + t) % keys); }));
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+}
+
 int main()
 {
     // Create a new Hash Table
@@ -229,8 +652,62 @@ int main()
     // Print the table
     table.printTable();
 
+    // Round trip the Table through a binary stream
+    stringstream stream;
+    table.serialize(stream, true);
+
+    HashTable copy;
+    copy.deserialize(stream);
+    copy.printTable();
+    copy.clear();
+
+    // Tables can be copied and moved around by value
+    HashTable duplicate(table);
+    HashTable moved(std::move(duplicate));
+
+    moved.put(23, 7);
+    copy = moved;
+    copy.printTable();
+
     table.clear();
     table.printTable();
 
+    // Hit counts from many threads at once
+    CounterTable hits;
+
+    hits.increment(7);
+    hits.increment(7, 2);
+    hits.incrementSharded(-3, 5);
+    hits.printTable();
+
+    cout << hits.clear() << endl;
+
+    // 32 threads counting over 64 keys, then all on one key
+    const int THREADS = 32, OPERATIONS = 100000;
+
+    mutex lock;
+    unordered_map<int, long> locked;
+
+    long lockedTime = hammer(THREADS, OPERATIONS, 64, [&](int key)
+                             {
+        lock_guard<mutex> guard(lock);
+        locked[key]++; });
+
+    long atomicTime = hammer(THREADS, OPERATIONS, 64, [&](int key)
+                             { hits.increment(key); });
+
+    long hotTime = hammer(THREADS, OPERATIONS, 1, [&](int key)
+                          { hits.increment(key); });
+
+    long shardedTime = hammer(THREADS, OPERATIONS, 1, [&](int key)
+                              { hits.incrementSharded(key); });
+
+    long total = 0;
+    hits.get(0, total);
+
+    cout << "Mutex : " << lockedTime << " ms, increment() : " << atomicTime << " ms" << endl;
+    cout << "One key, increment() : " << hotTime << " ms, incrementSharded() : " << shardedTime << " ms" << endl;
+    cout << total << " " << hits.keys() << endl;
+
     return 0;
 }
\ No newline at end of file
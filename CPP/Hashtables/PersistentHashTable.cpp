@@ -0,0 +1,617 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         PersistentHashTable.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Persistent Hash Table (Hash Array Mapped Trie) in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <chrono>
+
+using namespace std;
+
+// Holds the number of hash bits each level of the trie uses
+const int HAMT_BITS = 5;
+
+// Holds the number of slots in a Node (one bit of a uint32_t each)
+const int HAMT_SLOTS = 1 << HAMT_BITS;
+
+// Holds the number of bits in a hash
+// A Node this deep holds keys whose whole hash is the same
+const int HAMT_HASH_BITS = sizeof(size_t) * 8;
+
+// Represents a Node of the trie
+//
+// Each of the 32 slots is empty, holds an Entry, or holds a child
+// Node. Only the set slots take up room : the Entries and children
+// are kept in slot order, and the bits set below a slot's bit in
+// its map count how far into the vector it is.
+// A Node never changes once a Table points to it, so any number
+// of Tables (on any number of threads) may share it.
+template <class K, class V>
+struct HamtNode
+{
+    // Has a bit set for every slot holding an Entry
+    uint32_t entryMap;
+
+    // Has a bit set for every slot holding a child Node
+    uint32_t childMap;
+
+    // Hold the Entries, and the children, of the set slots
+    vector<pair<K, V>> entries;
+    vector<HamtNode<K, V> *> children;
+
+    // Holds the number of Tables and Nodes pointing to the Node
+    atomic<int> references;
+
+    // Holds the number of Nodes alive, in every Table
+    static inline atomic<long> alive{0};
+
+    // Constructor
+    HamtNode()
+    {
+        entryMap = childMap = 0;
+        references.store(1, memory_order_relaxed);
+
+        alive++;
+    }
+
+    // Destructor
+    ~HamtNode()
+    {
+        alive--;
+    }
+};
+
+// Represents a Persistent Hash Table, as a Hash Array Mapped Trie
+//
+// A Table is never changed : put() and remove() return a new Table.
+// Only the Nodes on the path from the Root down to the key are
+// copied, one per level (about log32(n) of them), and the new Nodes
+// point to the same children as the old ones for every other slot.
+// Copying a Table (taking a snapshot for readers) copies one pointer.
+template <class K, class V>
+class PersistentHashTable
+{
+    using Node = HamtNode<K, V>;
+
+    // Points to the Root of the trie (nullptr if the Table is empty)
+    Node *root;
+
+    // Holds the number of Entries
+    int count;
+
+    // Constructor
+    // The Table takes over a reference to root
+    PersistentHashTable(Node *root, int count)
+    {
+        this->root = root;
+        this->count = count;
+    }
+
+    // Returns the hash of the Key
+    static size_t getHash(const K &key)
+    {
+        return std::hash<K>()(key);
+    }
+
+    // Returns the bit of the slot a hash falls in, shift bits down
+    static uint32_t slotBit(size_t hash, int shift)
+    {
+        return 1u << ((hash >> shift) & (HAMT_SLOTS - 1));
+    }
+
+    // Returns where a slot's Entry or child is in its vector
+    static int slotIndex(uint32_t map, uint32_t bit)
+    {
+        return __builtin_popcount(map & (bit - 1));
+    }
+
+    // Adds a reference to a Node
+    static Node *retain(Node *node)
+    {
+        if (node)
+            node->references.fetch_add(1, memory_order_relaxed);
+
+        return node;
+    }
+
+    // Drops a reference to a Node, freeing it (and the children
+    // no one else points to) if it was the last one
+    static void release(Node *node)
+    {
+        if (node && node->references.fetch_sub(1, memory_order_acq_rel) == 1)
+        {
+            for (Node *child : node->children)
+                release(child);
+
+            delete node;
+        }
+    }
+
+    // Returns a new Node with the same slots as node
+    static Node *copyNode(Node *node)
+    {
+        Node *copy = new Node();
+
+        copy->entryMap = node->entryMap;
+        copy->childMap = node->childMap;
+        copy->entries = node->entries;
+        copy->children = node->children;
+
+        for (Node *child : copy->children)
+            retain(child);
+
+        return copy;
+    }
+
+    // Returns a Node holding two Entries whose hashes fall in the
+    // same slot up to shift, going down as many levels as it takes
+    // for them to fall in different slots
+    static Node *mergeEntries(pair<K, V> first, size_t firstHash, pair<K, V> second, size_t secondHash, int shift)
+    {
+        Node *node = new Node();
+
+        // Every hash bit is used up, so the keys share the whole hash
+        if (shift >= HAMT_HASH_BITS)
+        {
+            node->entries.push_back(std::move(first));
+            node->entries.push_back(std::move(second));
+
+            return node;
+        }
+
+        uint32_t firstBit = slotBit(firstHash, shift);
+        uint32_t secondBit = slotBit(secondHash, shift);
+
+        // Still the same slot, one more level down
+        if (firstBit == secondBit)
+        {
+            node->childMap = firstBit;
+            node->children.push_back(mergeEntries(std::move(first), firstHash, std::move(second), secondHash, shift + HAMT_BITS));
+        }
+        else
+        {
+            node->entryMap = firstBit | secondBit;
+
+            if (firstBit < secondBit)
+            {
+                node->entries.push_back(std::move(first));
+                node->entries.push_back(std::move(second));
+            }
+            else
+            {
+                node->entries.push_back(std::move(second));
+                node->entries.push_back(std::move(first));
+            }
+        }
+
+        return node;
+    }
+
+    // Returns a copy of node with key set to value
+    // added is set if the key wasn't there before
+    static Node *putIn(Node *node, size_t hash, int shift, const K &key, const V &value, bool &added)
+    {
+        // Keys this deep share their whole hash, so search them all
+        if (shift >= HAMT_HASH_BITS)
+        {
+            Node *copy = copyNode(node);
+
+            for (auto &entry : copy->entries)
+            {
+                if (entry.first == key)
+                {
+                    entry.second = value;
+                    return copy;
+                }
+            }
+
+            copy->entries.push_back({key, value});
+            added = true;
+
+            return copy;
+        }
+
+        uint32_t bit = slotBit(hash, shift);
+
+        // The slot holds an Entry
+        if (node->entryMap & bit)
+        {
+            int i = slotIndex(node->entryMap, bit);
+            Node *copy = copyNode(node);
+
+            // Same key, new value
+            if (node->entries[i].first == key)
+            {
+                copy->entries[i].second = value;
+                return copy;
+            }
+
+            // Another key, so both go down into a child Node
+            pair<K, V> existing = std::move(copy->entries[i]);
+            size_t existingHash = getHash(existing.first);
+
+            copy->entries.erase(copy->entries.begin() + i);
+            copy->entryMap ^= bit;
+
+            Node *child = mergeEntries(std::move(existing), existingHash, {key, value}, hash, shift + HAMT_BITS);
+
+            copy->children.insert(copy->children.begin() + slotIndex(copy->childMap, bit), child);
+            copy->childMap |= bit;
+
+            added = true;
+            return copy;
+        }
+
+        // The slot holds a child Node, so put the key in a copy of it
+        if (node->childMap & bit)
+        {
+            int i = slotIndex(node->childMap, bit);
+            Node *child = putIn(node->children[i], hash, shift + HAMT_BITS, key, value, added);
+            Node *copy = copyNode(node);
+
+            release(copy->children[i]);
+            copy->children[i] = child;
+
+            return copy;
+        }
+
+        // The slot is empty
+        Node *copy = copyNode(node);
+
+        copy->entries.insert(copy->entries.begin() + slotIndex(node->entryMap, bit), {key, value});
+        copy->entryMap |= bit;
+
+        added = true;
+        return copy;
+    }
+
+    // Returns a copy of node without key, or nullptr if the copy
+    // would be empty. Returns node itself if it doesn't hold the key
+    static Node *removeFrom(Node *node, size_t hash, int shift, const K &key)
+    {
+        // Keys this deep share their whole hash, so search them all
+        if (shift >= HAMT_HASH_BITS)
+        {
+            for (size_t i = 0; i < node->entries.size(); i++)
+            {
+                if (node->entries[i].first == key)
+                {
+                    if (node->entries.size() == 1)
+                        return nullptr;
+
+                    Node *copy = copyNode(node);
+                    copy->entries.erase(copy->entries.begin() + i);
+
+                    return copy;
+                }
+            }
+
+            return node;
+        }
+
+        uint32_t bit = slotBit(hash, shift);
+
+        // The slot holds the key's Entry
+        if ((node->entryMap & bit) && node->entries[slotIndex(node->entryMap, bit)].first == key)
+        {
+            // It is all the Node holds
+            if (node->entries.size() == 1 && !node->childMap)
+                return nullptr;
+
+            Node *copy = copyNode(node);
+
+            copy->entries.erase(copy->entries.begin() + slotIndex(node->entryMap, bit));
+            copy->entryMap ^= bit;
+
+            return copy;
+        }
+
+        // The slot holds a child Node the key may be in
+        if (node->childMap & bit)
+        {
+            int i = slotIndex(node->childMap, bit);
+            Node *child = removeFrom(node->children[i], hash, shift + HAMT_BITS, key);
+
+            // Not found
+            if (child == node->children[i])
+                return node;
+
+            // The child is gone, and it was all the Node held
+            if (!child && !node->entryMap && node->children.size() == 1)
+                return nullptr;
+
+            Node *copy = copyNode(node);
+
+            release(copy->children[i]);
+            copy->children.erase(copy->children.begin() + i);
+            copy->childMap ^= bit;
+
+            // A child left with one Entry is pulled up into the slot,
+            // so that no Node holds just one Entry below the Root
+            if (child && !child->childMap && child->entries.size() == 1)
+            {
+                copy->entries.insert(copy->entries.begin() + slotIndex(copy->entryMap, bit), child->entries[0]);
+                copy->entryMap |= bit;
+
+                release(child);
+            }
+            else if (child)
+            {
+                copy->children.insert(copy->children.begin() + i, child);
+                copy->childMap |= bit;
+            }
+
+            return copy;
+        }
+
+        // The key isn't in the Table
+        return node;
+    }
+
+    // Prints the Entries below a Node
+    static void printNode(Node *node)
+    {
+        for (auto &entry : node->entries)
+            cout << "[" << entry.first << " : " << entry.second << "] ";
+
+        for (Node *child : node->children)
+            printNode(child);
+    }
+
+public:
+    // Constructor
+    PersistentHashTable()
+    {
+        root = nullptr;
+        count = 0;
+    }
+
+    // Copy Constructor
+    // The copy shares every Node, so it is O(1)
+    PersistentHashTable(const PersistentHashTable &other)
+    {
+        root = retain(other.root);
+        count = other.count;
+    }
+
+    // Move Constructor
+    PersistentHashTable(PersistentHashTable &&other) noexcept
+    {
+        root = other.root;
+        count = other.count;
+
+        other.root = nullptr;
+        other.count = 0;
+    }
+
+    // Copy and Move Assignment
+    PersistentHashTable &operator=(PersistentHashTable other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    // Frees the Nodes no other Table shares
+    ~PersistentHashTable()
+    {
+        release(root);
+    }
+
+    // Trades Nodes with another Table
+    void swap(PersistentHashTable &other) noexcept
+    {
+        std::swap(root, other.root);
+        std::swap(count, other.count);
+    }
+
+    // Returns a Table with key set to value
+    PersistentHashTable put(const K &key, const V &value) const
+    {
+        size_t hash = getHash(key);
+
+        // The first Entry gets a Root of its own
+        if (!root)
+        {
+            Node *node = new Node();
+
+            node->entryMap = slotBit(hash, 0);
+            node->entries.push_back({key, value});
+
+            return PersistentHashTable(node, 1);
+        }
+
+        bool added = false;
+        Node *updated = putIn(root, hash, 0, key, value, added);
+
+        return PersistentHashTable(updated, count + added);
+    }
+
+    // Returns a Table without key
+    PersistentHashTable remove(const K &key) const
+    {
+        if (!root)
+            return *this;
+
+        Node *updated = removeFrom(root, getHash(key), 0, key);
+
+        // Key not found, so the Table is the same
+        if (updated == root)
+            return *this;
+
+        return PersistentHashTable(updated, count - 1);
+    }
+
+    // Gives back the value of a key
+    bool get(const K &key, V &value) const
+    {
+        size_t hash = getHash(key);
+        int shift = 0;
+
+        for (Node *node = root; node; shift += HAMT_BITS)
+        {
+            // Keys this deep share their whole hash, so search them all
+            if (shift >= HAMT_HASH_BITS)
+            {
+                for (auto &entry : node->entries)
+                {
+                    if (entry.first == key)
+                    {
+                        value = entry.second;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            uint32_t bit = slotBit(hash, shift);
+
+            if (node->entryMap & bit)
+            {
+                auto &entry = node->entries[slotIndex(node->entryMap, bit)];
+
+                if (!(entry.first == key))
+                    return false;
+
+                value = entry.second;
+                return true;
+            }
+
+            if (!(node->childMap & bit))
+                return false;
+
+            node = node->children[slotIndex(node->childMap, bit)];
+        }
+
+        return false;
+    }
+
+    // Returns the number of Entries
+    int size() const
+    {
+        return count;
+    }
+
+    // Prints the entire Hash Table
+    void printTable() const
+    {
+        if (root)
+            printNode(root);
+
+        cout << endl;
+    }
+};
+
+// Keeps a snapshot of a Table of n Entries after every one of
+// updates put()s, against deep copying a mutable Table
+void snapshotsAgainstCopies(int n, int updates)
+{
+    PersistentHashTable<int, int> table;
+    unordered_map<int, int> mutableTable;
+
+    for (int i = 0; i < n; i++)
+    {
+        table = table.put(i, i);
+        mutableTable[i] = i;
+    }
+
+    long nodesBefore = HamtNode<int, int>::alive.load();
+
+    vector<PersistentHashTable<int, int>> snapshots;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < updates; i++)
+    {
+        table = table.put(i * 7919 % n, -i);
+        snapshots.push_back(table);
+    }
+
+    auto sharing = chrono::steady_clock::now() - start;
+    long newNodes = HamtNode<int, int>::alive.load() - nodesBefore;
+
+    vector<unordered_map<int, int>> copies;
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < updates; i++)
+    {
+        mutableTable[i * 7919 % n] = -i;
+        copies.push_back(mutableTable);
+    }
+
+    auto copying = chrono::steady_clock::now() - start;
+
+    cout << updates << " snapshots : " << chrono::duration_cast<chrono::microseconds>(sharing).count() << " us, "
+         << newNodes << " new Nodes (" << nodesBefore << " shared), deep copies : "
+         << chrono::duration_cast<chrono::microseconds>(copying).count() << " us, "
+         << (long)updates * n << " Entries copied" << endl;
+}
+
+int main()
+{
+    // Create a new Persistent Hash Table
+    PersistentHashTable<string, string> empty;
+
+    PersistentHashTable<string, string> table = empty.put("adam", "19").put("eve", "22").put("john", "4").put("doe", "87");
+    table.printTable();
+
+    // Every version stays as it was
+    PersistentHashTable<string, string> older = table.put("adam", "20").remove("eve");
+
+    string result;
+    if (table.get("adam", result))
+        cout << result << " ";
+    if (older.get("adam", result))
+        cout << result << " ";
+
+    cout << table.get("eve", result) << " " << older.get("eve", result) << endl;
+    cout << empty.size() << " " << table.size() << " " << older.size() << endl;
+
+    // A reader thread works from a snapshot while the Table moves on
+    PersistentHashTable<int, int> squares;
+
+    for (int i = 0; i < 1000; i++)
+        squares = squares.put(i, i * i);
+
+    PersistentHashTable<int, int> snapshot = squares;
+
+    thread reader([snapshot]
+                  {
+        long sum = 0;
+        int square;
+
+        for (int i = 0; i < 1000; i++)
+        {
+            if (snapshot.get(i, square))
+                sum += square;
+        }
+
+        cout << sum << endl; });
+
+    for (int i = 0; i < 1000; i += 2)
+        squares = squares.remove(i);
+
+    reader.join();
+    cout << squares.size() << " " << snapshot.size() << endl;
+
+    snapshotsAgainstCopies(100000, 100);
+
+    return 0;
+}
@@ -0,0 +1,502 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         RcuHashTable.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Read-copy-update Hash Table for lock-free readers in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Versions share chunks of "buckets", a write copies one chunk
+ * 2026-October-19	[AG] : Moved out of GenericHashTable.cpp
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+#include "../Concurrency/MemoryReclamation.h"
+#include "../Serialization/DumpWriter.h"
+
+using namespace std;
+
+// Represents an Entry of an RcuHashTable
+// Once published an Entry is never changed, only replaced
+template <class K, class V>
+struct RcuEntry
+{
+    // Holds the key of the Entry
+    K key;
+
+    // Holds the value of the Entry
+    V value;
+
+    // Points to the Collision Entry
+    RcuEntry<K, V> *collisionEntry;
+
+    // Constructor
+    RcuEntry(K k, V v, RcuEntry<K, V> *next) : key(std::move(k)), value(std::move(v))
+    {
+        collisionEntry = next;
+    }
+};
+
+// Holds the number of "buckets" in a chunk
+const size_t RCU_CHUNK_BUCKETS = 256;
+
+// Represents a chunk of the "buckets" of an RcuHashTable
+// Once published a chunk is never changed, only replaced
+template <class K, class V>
+struct RcuChunk
+{
+    // Points to the first Entry of each "bucket"
+    RcuEntry<K, V> *buckets[RCU_CHUNK_BUCKETS];
+
+    // Constructor
+    RcuChunk()
+    {
+        for (size_t i = 0; i < RCU_CHUNK_BUCKETS; i++)
+            buckets[i] = nullptr;
+    }
+};
+
+// Represents one version of an RcuHashTable
+//
+// The "buckets" are split in chunks of RCU_CHUNK_BUCKETS, and
+// versions share every chunk they don't change, so a new version
+// costs a copy of the directory of chunks and of one chunk
+template <class K, class V>
+struct RcuVersion
+{
+    // Point to the chunks of "buckets"
+    vector<RcuChunk<K, V> *> chunks;
+
+    // Holds the number of "buckets"
+    size_t buckets;
+
+    // Holds the number of Entries
+    size_t count;
+
+    // Returns the first Entry of "bucket" i
+    RcuEntry<K, V> *&bucket(size_t i)
+    {
+        return chunks[i / RCU_CHUNK_BUCKETS]->buckets[i % RCU_CHUNK_BUCKETS];
+    }
+};
+
+/**
+ * A Hash Table for many readers and one writer at a time
+ * (read-copy-update).
+ *
+ * Readers take a Snapshot, which is a single atomic load of the
+ * current version. Everything reachable from a version is never
+ * changed, so lookups in a Snapshot take no locks and no atomics,
+ * and see the Table exactly as it was when the Snapshot was taken.
+ *
+ * The writer never changes a published Entry or chunk of "buckets".
+ * It copies the directory of chunks, the one chunk holding the
+ * "bucket" it changes, and only the front of that Collision List,
+ * down to the Entry it replaces or removes; the rest of that List,
+ * and every other chunk and List, are shared with the old version.
+ * The new version is then published with one atomic store. A write
+ * copies 1/256th of the "buckets" it used to, plus one chunk.
+ *
+ * The old version, and the chunks and Entries only it could reach, are retired
+ * to the EpochReclaimer, which frees them once every Snapshot that
+ * could see them is gone (the "grace period").
+ */
+template <class K, class V>
+class RcuHashTable
+{
+    // Points to the current version
+    atomic<RcuVersion<K, V> *> current;
+
+    // Keeps writers from running at once
+    mutex writeLock;
+
+    // Returns the hash of the Key for a number of "buckets"
+    static size_t getHash(const K &key, size_t size)
+    {
+        return std::hash<K>()(key) % size;
+    }
+
+    // Returns the first Entry with key in a Collision List
+    static RcuEntry<K, V> *findEntry(RcuEntry<K, V> *current, const K &key)
+    {
+        for (; current; current = current->collisionEntry)
+        {
+            if (key == current->key)
+                return current;
+        }
+
+        return nullptr;
+    }
+
+    // Copies the Entries of a Collision List before stop, ending the
+    // copy at replacement instead of stop. The Entries it replaces
+    // (upto and including stop) are added to replaced
+    static RcuEntry<K, V> *rewrite(RcuEntry<K, V> *head, RcuEntry<K, V> *stop, RcuEntry<K, V> *replacement,
+                                   vector<RcuEntry<K, V> *> &replaced)
+    {
+        size_t first = replaced.size();
+
+        for (RcuEntry<K, V> *current = head; current != stop; current = current->collisionEntry)
+            replaced.push_back(current);
+
+        // Copy them back to front, so each copy can point to the next one
+        for (size_t i = replaced.size(); i > first; i--)
+            replacement = new RcuEntry<K, V>(replaced[i - 1]->key, replaced[i - 1]->value, replacement);
+
+        replaced.push_back(stop);
+
+        return replacement;
+    }
+
+    // Returns a version of "buckets" empty "buckets"
+    static RcuVersion<K, V> *emptyVersion(size_t buckets)
+    {
+        RcuVersion<K, V> *version = new RcuVersion<K, V>();
+
+        version->buckets = buckets;
+        version->count = 0;
+
+        for (size_t i = 0; i < buckets; i += RCU_CHUNK_BUCKETS)
+            version->chunks.push_back(new RcuChunk<K, V>());
+
+        return version;
+    }
+
+    // Returns the next version of old, sharing every chunk with it
+    // but the one holding "bucket" hash, which is copied
+    // The chunk copied from is added to replacedChunks
+    static RcuVersion<K, V> *copyChunk(RcuVersion<K, V> *old, size_t hash, vector<RcuChunk<K, V> *> &replacedChunks)
+    {
+        RcuVersion<K, V> *next = new RcuVersion<K, V>(*old);
+        size_t chunk = hash / RCU_CHUNK_BUCKETS;
+
+        next->chunks[chunk] = new RcuChunk<K, V>(*old->chunks[chunk]);
+        replacedChunks.push_back(old->chunks[chunk]);
+
+        return next;
+    }
+
+    // Makes a new version current, and retires the old one
+    // with the chunks and Entries that only it could reach
+    void publish(RcuVersion<K, V> *next, RcuVersion<K, V> *old, vector<RcuChunk<K, V> *> &replacedChunks,
+                 vector<RcuEntry<K, V> *> &replaced)
+    {
+        current.store(next, memory_order_release);
+
+        for (auto chunk : replacedChunks)
+            EpochReclaimer::retire(chunk);
+
+        EpochReclaimer::retire(old);
+
+        for (auto entry : replaced)
+            EpochReclaimer::retire(entry);
+    }
+
+    // Returns every Entry of a version
+    static void collectEntries(RcuVersion<K, V> *version, vector<RcuEntry<K, V> *> &entries)
+    {
+        for (size_t i = 0; i < version->buckets; i++)
+        {
+            for (auto entry = version->bucket(i); entry; entry = entry->collisionEntry)
+                entries.push_back(entry);
+        }
+    }
+
+    // Doubles the number of "buckets", copying every Entry
+    void grow(RcuVersion<K, V> *old)
+    {
+        RcuVersion<K, V> *next = emptyVersion(old->buckets * 2 + 1);
+        next->count = old->count;
+
+        vector<RcuEntry<K, V> *> replaced;
+        collectEntries(old, replaced);
+
+        // Older Entries go in first, so newer ones stay in front
+        for (size_t i = replaced.size(); i > 0; i--)
+        {
+            RcuEntry<K, V> *entry = replaced[i - 1];
+            size_t hash = getHash(entry->key, next->buckets);
+
+            next->bucket(hash) = new RcuEntry<K, V>(entry->key, entry->value, next->bucket(hash));
+        }
+
+        publish(next, old, old->chunks, replaced);
+    }
+
+public:
+    // A consistent, unchanging view of the Table
+    // The Table's memory is not freed while a Snapshot is alive,
+    // so Snapshots should be short lived, and stay on one thread
+    class Snapshot
+    {
+        // Keeps the version from being freed
+        EpochReclaimer::Guard guard;
+
+        // Points to the version being read
+        RcuVersion<K, V> *version;
+
+    public:
+        // Constructor
+        Snapshot(const atomic<RcuVersion<K, V> *> &source)
+        {
+            version = guard.protect(source);
+        }
+
+        // Gets the value of a key from the Snapshot
+        bool get(K key, V &value)
+        {
+            RcuEntry<K, V> *found = findEntry(version->bucket(getHash(key, version->buckets)), key);
+
+            // No such key in the Snapshot
+            if (!found)
+                return false;
+
+            value = found->value;
+            return true;
+        }
+
+        // Returns the number of Entries in the Snapshot
+        size_t size()
+        {
+            return version->count;
+        }
+
+        // Writes every Entry to a stream, "bucket" by "bucket"
+        // Readers dump at the same time, so each thread has a buffer
+        bool dump(ostream &out, DumpFormat format = DUMP_TEXT)
+        {
+            static thread_local string buffer;
+            DumpWriter writer(out, format, buffer);
+
+            for (size_t i = 0; i < version->buckets; i++)
+            {
+                writer.beginBucket(i);
+
+                for (auto current = version->bucket(i); current; current = current->collisionEntry)
+                    writer.entry(current->key, current->value, current->collisionEntry);
+
+                writer.endBucket();
+            }
+
+            return writer.finish();
+        }
+
+        // Prints the entire Snapshot
+        void printTable()
+        {
+            dump(cout);
+        }
+    };
+
+    // Constructor
+    RcuHashTable(int initialSize = 11)
+    {
+        current.store(emptyVersion(initialSize));
+    }
+
+    // Readers may still be using the Table, so it can't be copied
+    RcuHashTable(const RcuHashTable &) = delete;
+    RcuHashTable &operator=(const RcuHashTable &) = delete;
+
+    // Destructor
+    // No other thread may be using the Table by now
+    ~RcuHashTable()
+    {
+        clear();
+
+        RcuVersion<K, V> *last = current.load();
+
+        for (auto chunk : last->chunks)
+            delete chunk;
+
+        delete last;
+    }
+
+    // Returns a Snapshot of the Table as it is now
+    Snapshot snapshot()
+    {
+        return Snapshot(current);
+    }
+
+    // Gets the value of a key from the Table
+    bool get(K key, V &value)
+    {
+        return snapshot().get(key, value);
+    }
+
+    // Adds a value to the Table, replacing the value of an existing key
+    void put(K key, V value)
+    {
+        lock_guard<mutex> guard(writeLock);
+        RcuVersion<K, V> *old = current.load(memory_order_relaxed);
+
+        // Keep the Collision Lists short
+        if (old->count >= old->buckets * 2)
+        {
+            grow(old);
+            old = current.load(memory_order_relaxed);
+        }
+
+        size_t hash = getHash(key, old->buckets);
+        RcuEntry<K, V> *found = findEntry(old->bucket(hash), key);
+
+        // The new version shares every other chunk and
+        // Collision List with the old one
+        vector<RcuChunk<K, V> *> replacedChunks;
+        vector<RcuEntry<K, V> *> replaced;
+        RcuVersion<K, V> *next = copyChunk(old, hash, replacedChunks);
+
+        // A new key goes at the front of the Collision List
+        if (!found)
+        {
+            next->bucket(hash) = new RcuEntry<K, V>(key, value, old->bucket(hash));
+            next->count++;
+        }
+
+        // Else copy the List down to the Entry being replaced
+        else
+        {
+            RcuEntry<K, V> *replacement = new RcuEntry<K, V>(key, value, found->collisionEntry);
+            next->bucket(hash) = rewrite(old->bucket(hash), found, replacement, replaced);
+        }
+
+        publish(next, old, replacedChunks, replaced);
+    }
+
+    // Removes a key-value pair from the Table
+    bool remove(K key)
+    {
+        lock_guard<mutex> guard(writeLock);
+        RcuVersion<K, V> *old = current.load(memory_order_relaxed);
+
+        size_t hash = getHash(key, old->buckets);
+        RcuEntry<K, V> *found = findEntry(old->bucket(hash), key);
+
+        // No such key in the Table
+        if (!found)
+            return false;
+
+        // Copy the List down to the removed Entry, and skip it
+        vector<RcuChunk<K, V> *> replacedChunks;
+        vector<RcuEntry<K, V> *> replaced;
+        RcuVersion<K, V> *next = copyChunk(old, hash, replacedChunks);
+
+        next->bucket(hash) = rewrite(old->bucket(hash), found, found->collisionEntry, replaced);
+        next->count--;
+
+        publish(next, old, replacedChunks, replaced);
+
+        return true;
+    }
+
+    // Returns the number of Entries in the Table
+    size_t size()
+    {
+        return current.load(memory_order_acquire)->count;
+    }
+
+    // Clears the entire Table
+    int clear()
+    {
+        lock_guard<mutex> guard(writeLock);
+        RcuVersion<K, V> *old = current.load(memory_order_relaxed);
+
+        RcuVersion<K, V> *next = emptyVersion(old->buckets);
+
+        vector<RcuEntry<K, V> *> replaced;
+        collectEntries(old, replaced);
+
+        int counter = replaced.size();
+        publish(next, old, old->chunks, replaced);
+
+        return counter;
+    }
+
+    // Writes every Entry to a stream, as they were when it started
+    bool dump(ostream &out, DumpFormat format = DUMP_TEXT)
+    {
+        return snapshot().dump(out, format);
+    }
+
+    // Prints the entire Hash Table
+    void printTable()
+    {
+        snapshot().printTable();
+    }
+};
+
+// Times n put()s replacing values in an RcuHashTable of size
+// Entries, which copy a chunk of "buckets" each however big it is
+void writesAgainstSize(int size, int n)
+{
+    RcuHashTable<int, int> table;
+
+    for (int i = 0; i < size; i++)
+        table.put(i, i);
+
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < n; i++)
+        table.put(i % size, i);
+
+    auto writing = chrono::steady_clock::now() - start;
+
+    cout << n << " put()s in " << size << " Entries : "
+         << chrono::duration_cast<chrono::microseconds>(writing).count() << " us" << endl;
+}
+
+int main()
+{
+    // Readers see whole versions while a writer updates a route
+    RcuHashTable<string, int> routes;
+
+    routes.put("eth0", 1);
+    routes.put("eth1", 2);
+
+    atomic<bool> done(false);
+    atomic<long> torn(0);
+
+    thread reader([&]
+                  {
+        while (!done.load())
+        {
+            // Both reads come from the same version
+            auto snapshot = routes.snapshot();
+            int first = 0, second = 0;
+
+            snapshot.get("eth0", first);
+            snapshot.get("eth0", second);
+
+            if (first != second)
+                torn++;
+        } });
+
+    for (int i = 0; i < 1000; i++)
+        routes.put("eth0", i);
+
+    routes.remove("eth1");
+
+    done.store(true);
+    reader.join();
+
+    routes.printTable();
+    cout << routes.size() << " " << torn.load() << endl;
+
+    // A write costs about the same in a small and a big Table
+    writesAgainstSize(1000, 100000);
+    writesAgainstSize(100000, 100000);
+
+    return 0;
+}
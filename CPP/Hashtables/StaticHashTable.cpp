@@ -0,0 +1,334 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         StaticHashTable.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Fixed capacity, compile-time Hash Table for integer keys in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+using namespace std;
+
+/**
+ * Unlike HashTable, this Table never touches the heap.
+ * Every Entry lives in arrays inside the Table itself
+ * ("open addressing"), and a collision simply moves on
+ * to the next slot ("linear probing").
+ *
+ * Capacity is a power of two, so the slot of a hash is
+ * found with a mask instead of %.
+ *
+ * Everything is constexpr, so a Table built from a list
+ * of pairs at compile time costs nothing at startup.
+ */
+template <class K, class V, size_t Capacity>
+class StaticHashTable
+{
+    static_assert(is_integral<K>::value || is_enum<K>::value, "Keys must be integers or enums");
+    static_assert(Capacity && !(Capacity & (Capacity - 1)), "Capacity must be a power of two");
+
+    // Number of seeds tried when looking for a perfect hash
+    static constexpr uint64_t MAX_SEEDS = 64;
+
+    // Hold the keys and values of each slot
+    K keys[Capacity];
+    V values[Capacity];
+
+    // Tells if a slot holds an Entry
+    bool used[Capacity];
+
+    // Holds the number of Entries
+    size_t count;
+
+    // Holds the seed mixed into the hash
+    uint64_t seed;
+
+    // True if no two keys share a slot, so a lookup
+    // never has to probe past the first slot
+    bool perfect;
+
+    // Returns the slot of a key for a given seed
+    static constexpr size_t getSlot(K key, uint64_t seed)
+    {
+        // Mix the bits of the key (MurmurHash3's finalizer)
+        uint64_t hash = (uint64_t)key ^ (seed * 0x9E3779B97F4A7C15ull);
+
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+
+        return hash & (Capacity - 1);
+    }
+
+    // Returns the slot holding a key, or Capacity if there is none
+    constexpr size_t find(K key) const
+    {
+        size_t slot = getSlot(key, seed);
+
+        // With a perfect hash the key can only be in one place
+        if (perfect)
+            return (used[slot] && keys[slot] == key) ? slot : Capacity;
+
+        // Probe until the key or an empty slot turns up
+        for (size_t probes = 0; probes < Capacity && used[slot]; probes++)
+        {
+            // Key found
+            if (keys[slot] == key)
+                return slot;
+
+            slot = (slot + 1) & (Capacity - 1);
+        }
+
+        // No such key in the Table
+        return Capacity;
+    }
+
+    // Tells if every key lands in its own slot with a given seed
+    template <size_t N>
+    static constexpr bool isPerfect(const pair<K, V> (&pairs)[N], uint64_t seed)
+    {
+        bool taken[Capacity] = {};
+
+        for (size_t i = 0; i < N; i++)
+        {
+            size_t slot = getSlot(pairs[i].first, seed);
+
+            if (taken[slot])
+                return false;
+
+            taken[slot] = true;
+        }
+
+        return true;
+    }
+
+public:
+    // Constructor
+    // Creates an empty Table
+    constexpr StaticHashTable() : keys(), values(), used(), count(0), seed(0), perfect(false)
+    {
+    }
+
+    // Constructor
+    // Builds the Table from a list of pairs, looking for a seed
+    // that gives every key its own slot (a perfect hash).
+    // If none is found, it falls back to linear probing
+    template <size_t N>
+    constexpr StaticHashTable(const pair<K, V> (&pairs)[N]) : keys(), values(), used(), count(0), seed(0), perfect(false)
+    {
+        static_assert(N <= Capacity, "Too many pairs for the Capacity");
+
+        for (uint64_t candidate = 0; candidate < MAX_SEEDS; candidate++)
+        {
+            if (isPerfect(pairs, candidate))
+            {
+                seed = candidate;
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < N; i++)
+            put(pairs[i].first, pairs[i].second);
+
+        // put() has already checked every key against the others
+        perfect = isPerfect(pairs, seed);
+    }
+
+    // Adds a value to the Table, replacing the value of an existing key
+    // Returns false if the Table is full
+    constexpr bool put(K key, V value)
+    {
+        size_t slot = getSlot(key, seed);
+
+        // Probe until the key or an empty slot turns up
+        for (size_t probes = 0; probes < Capacity; probes++)
+        {
+            // A new key
+            if (!used[slot])
+            {
+                // It didn't land in its own slot
+                if (probes)
+                    perfect = false;
+
+                used[slot] = true;
+                keys[slot] = key;
+                values[slot] = value;
+                count++;
+
+                return true;
+            }
+
+            // Key found, replace its value
+            if (keys[slot] == key)
+            {
+                values[slot] = value;
+                return true;
+            }
+
+            slot = (slot + 1) & (Capacity - 1);
+        }
+
+        // The Table is full
+        return false;
+    }
+
+    // Gets the value of a key from the Table
+    constexpr bool get(K key, V &value) const
+    {
+        size_t slot = find(key);
+
+        // No such key in the Table
+        if (Capacity == slot)
+            return false;
+
+        value = values[slot];
+        return true;
+    }
+
+    // Returns the value of a key, or fallback if there is no such key
+    constexpr V getOr(K key, V fallback) const
+    {
+        size_t slot = find(key);
+
+        return Capacity == slot ? fallback : values[slot];
+    }
+
+    // Tells if a key is in the Table
+    constexpr bool contains(K key) const
+    {
+        return Capacity != find(key);
+    }
+
+    // Removes a key-value pair from the Table
+    constexpr bool remove(K key)
+    {
+        size_t hole = find(key);
+
+        // No such key in the Table
+        if (Capacity == hole)
+            return false;
+
+        used[hole] = false;
+        count--;
+
+        // Shift the Entries after the hole back, so that
+        // probing never stops early at the hole
+        for (size_t slot = (hole + 1) & (Capacity - 1); used[slot]; slot = (slot + 1) & (Capacity - 1))
+        {
+            size_t home = getSlot(keys[slot], seed);
+
+            // Only move an Entry whose home slot is not
+            // between the hole and where it sits now
+            if (((slot - home) & (Capacity - 1)) >= ((slot - hole) & (Capacity - 1)))
+            {
+                keys[hole] = keys[slot];
+                values[hole] = values[slot];
+                used[hole] = true;
+                used[slot] = false;
+
+                hole = slot;
+            }
+        }
+
+        return true;
+    }
+
+    // Returns the number of Entries in the Table
+    constexpr size_t size() const
+    {
+        return count;
+    }
+
+    // Tells if every key sits in its own slot
+    constexpr bool isPerfect() const
+    {
+        return perfect;
+    }
+
+    // Prints the entire Hash Table
+    void printTable() const
+    {
+        string output = "\n";
+
+        // Print the Entry in each slot
+        for (size_t i = 0; i < Capacity; i++)
+        {
+            output += ("[" + to_string(i) + "] => ");
+
+            if (used[i])
+                output += ("[" + to_string((uint64_t)keys[i]) + " : " + to_string(values[i]) + "]");
+
+            cout << output << endl;
+            output = "";
+        }
+    }
+};
+
+// Some opcodes and their operand counts
+enum Opcode
+{
+    NOP = 0x00,
+    PUSH = 0x10,
+    POP = 0x11,
+    ADD = 0x20,
+    JUMP = 0x30,
+    CALL = 0x31,
+    RETURN = 0x32,
+};
+
+constexpr pair<Opcode, int> operandCounts[] = {
+    {NOP, 0},
+    {PUSH, 1},
+    {POP, 0},
+    {ADD, 2},
+    {JUMP, 1},
+    {CALL, 1},
+    {RETURN, 0},
+};
+
+// Built entirely at compile time
+constexpr StaticHashTable<Opcode, int, 16> opcodeTable(operandCounts);
+
+static_assert(opcodeTable.getOr(ADD, -1) == 2, "ADD takes two operands");
+static_assert(!opcodeTable.contains((Opcode)0x40), "0x40 is not an opcode");
+
+int main()
+{
+    opcodeTable.printTable();
+
+    cout << "Perfect hash : " << opcodeTable.isPerfect() << endl;
+
+    // The same Table also works at runtime
+    StaticHashTable<int, int, 8> table;
+
+    table.put(1, 19);
+    table.put(12, 43);
+    table.put(29, 89);
+    table.put(54, 44);
+
+    table.printTable();
+
+    int result;
+    if (table.get(29, result))
+        cout << result << endl;
+
+    table.remove(12);
+    cout << table.contains(12) << " " << table.size() << endl;
+
+    return 0;
+}
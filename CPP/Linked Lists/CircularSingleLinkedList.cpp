@@ -0,0 +1,363 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         CircularSingleLinkedList.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Circular Single Linked List in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <chrono>
+
+using namespace std;
+
+// Node represents a value in the Link List
+template <class V>
+struct Node
+{
+    // Holds the value of the Node
+    V value;
+
+    // Points to the next Node
+    Node<V> *next;
+
+    // Constructor
+    Node(V v)
+    {
+        this->value = v;
+        this->next = nullptr;
+    }
+};
+
+// Represents a Circular Single Linked List
+//
+// Only the Tail is kept : the Tail's next is the Head, which is
+// the "current" value of a round-robin. Moving the Tail one Node
+// ahead makes the next Node current, so going round the List never
+// allocates or frees a Node, and neither does removing the current one
+template <class V>
+class CircularSingleLinkedList
+{
+    // Points to the Tail of the List (nullptr if it is empty)
+    Node<V> *tail;
+
+    // Holds the number of Nodes
+    int count;
+
+public:
+    // Default Constructor
+    CircularSingleLinkedList()
+    {
+        tail = nullptr;
+        count = 0;
+    }
+
+    // Copy Constructor
+    // The copy gets Nodes of its own, and the same current Node
+    CircularSingleLinkedList(const CircularSingleLinkedList &other) : CircularSingleLinkedList()
+    {
+        if (other.tail)
+        {
+            Node<V> *current = other.tail;
+
+            do
+            {
+                current = current->next;
+                pushBack(current->value);
+            } while (current != other.tail);
+        }
+    }
+
+    // Move Constructor
+    // Takes other's Nodes, leaving it empty
+    CircularSingleLinkedList(CircularSingleLinkedList &&other) noexcept : CircularSingleLinkedList()
+    {
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the List moved from),
+    // so its Nodes are taken and ours go away with it
+    CircularSingleLinkedList &operator=(CircularSingleLinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~CircularSingleLinkedList()
+    {
+        clear();
+    }
+
+    // Trades Nodes with another List
+    void swap(CircularSingleLinkedList &other) noexcept
+    {
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+    }
+
+    // Adds a Node at the Back of the List
+    // (it will be current last, after every other Node)
+    void pushBack(V value)
+    {
+        pushFront(value);
+
+        // The new Head becomes the Tail instead
+        tail = tail->next;
+    }
+
+    // Adds a Node at the Front of the List
+    // (it becomes the current Node)
+    void pushFront(V value)
+    {
+        Node<V> *newNode = new Node<V>(value);
+
+        // If this is the First Node in the List
+        // it is its own next Node
+        if (!tail)
+        {
+            newNode->next = newNode;
+            tail = newNode;
+        }
+
+        // Else link it in between the Tail and the Head
+        else
+        {
+            newNode->next = tail->next;
+            tail->next = newNode;
+        }
+
+        count++;
+    }
+
+    // Returns the current value (the Head's)
+    // The List must not be empty
+    V &current()
+    {
+        return tail->next->value;
+    }
+
+    // Makes the next Node current
+    void advance()
+    {
+        if (tail)
+            tail = tail->next;
+    }
+
+    // Makes the Node k Nodes ahead current
+    // Going round the whole List changes nothing,
+    // so this takes k % size() steps
+    void rotate(int k)
+    {
+        if (!tail)
+            return;
+
+        // A negative k goes backward
+        k %= count;
+        if (k < 0)
+            k += count;
+
+        for (; k; k--)
+            tail = tail->next;
+    }
+
+    // Removes the current Node, and makes the next one current
+    bool removeCurrent()
+    {
+        // The List is empty
+        if (!tail)
+            return false;
+
+        Node<V> *head = tail->next;
+
+        // If this is the ONLY Node in the List
+        if (head == tail)
+            tail = nullptr;
+        else
+            tail->next = head->next;
+
+        delete head;
+        count--;
+
+        return true;
+    }
+
+    // Removes a value from the List
+    bool remove(V value)
+    {
+        // If the List is not already empty
+        if (tail)
+        {
+            Node<V> *previous = tail;
+
+            // Search for the value in the List, starting at the Head
+            do
+            {
+                Node<V> *current = previous->next;
+
+                // Value found
+                if (current->value == value)
+                {
+                    // If this is the ONLY Node in the List
+                    if (current == previous)
+                        tail = nullptr;
+
+                    else
+                    {
+                        // Disconnect current Node from the List
+                        previous->next = current->next;
+
+                        // If the value is at the Tail
+                        // make the Tail go one Node back
+                        if (current == tail)
+                            tail = previous;
+                    }
+
+                    delete current;
+                    count--;
+
+                    return true;
+                }
+
+                previous = current;
+            } while (previous != tail);
+        }
+
+        // Value not found in the List
+        // or the List is empty
+        return false;
+    }
+
+    // Returns the number of Nodes
+    int size()
+    {
+        return count;
+    }
+
+    // Prints the List forward, starting at the current Node
+    void printForward()
+    {
+        // Only if the List is not empty
+        if (tail)
+        {
+            Node<V> *current = tail->next;
+
+            do
+            {
+                cout << current->value;
+
+                if (current != tail)
+                    cout << " -> ";
+
+                current = current->next;
+            } while (current != tail->next);
+        }
+
+        cout << endl;
+    }
+
+    // Clears the List
+    int clear()
+    {
+        int counter = 0;
+
+        // If the List is not already empty
+        if (tail)
+        {
+            // Break the circle after the Tail
+            // and delete Nodes from the Head on
+            Node<V> *current = tail->next;
+            tail->next = nullptr;
+
+            for (Node<V> *next; current; current = next)
+            {
+                next = current->next;
+
+                delete current;
+                counter++;
+            }
+
+            tail = nullptr;
+            count = 0;
+        }
+
+        return counter;
+    }
+};
+
+int main()
+{
+    // Make a new List
+    CircularSingleLinkedList<int> list;
+
+    list.pushBack(5);
+    list.pushBack(7);
+    list.pushBack(1);
+    list.pushFront(3);
+
+    list.printForward();
+
+    // Go round
+    list.advance();
+    list.printForward();
+
+    list.rotate(-1);
+    cout << list.current() << endl;
+
+    list.removeCurrent();
+    list.printForward();
+
+    list.remove(1);
+    list.printForward();
+
+    cout << list.clear() << endl;
+
+    // A round-robin over 1000 tasks, visiting each one 1000 times
+    CircularSingleLinkedList<int> tasks;
+
+    for (int i = 0; i < 1000; i++)
+        tasks.pushBack(i);
+
+    long visited = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        visited += tasks.current();
+        tasks.advance();
+    }
+
+    auto advancing = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    // The same round-robin by taking the current task
+    // off the Front and pushing it at the Back again
+    for (int i = 0; i < 1000000; i++)
+    {
+        int task = tasks.current();
+        visited += task;
+
+        tasks.removeCurrent();
+        tasks.pushBack(task);
+    }
+
+    auto repushing = chrono::steady_clock::now() - start;
+
+    cout << "advance() : " << chrono::duration_cast<chrono::microseconds>(advancing).count() << " us, "
+         << "re-push : " << chrono::duration_cast<chrono::microseconds>(repushing).count() << " us ("
+         << visited << ")" << endl;
+
+    tasks.clear();
+
+    return 0;
+}
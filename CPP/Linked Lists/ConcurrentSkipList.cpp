@@ -0,0 +1,570 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         ConcurrentSkipList.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Lock-free Skip List (ordered map) in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Free removed Nodes through EpochReclaimer
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include "../Concurrency/MemoryReclamation.h"
+
+using namespace std;
+
+// The lowest bit of a next pointer marks
+// its Node as removed from that level
+const uintptr_t REMOVED_MARK = 1;
+
+// Who frees a removed Node depends on whether
+// its inserter was done linking it (see erase())
+const int NODE_LINKING = 0;
+const int NODE_LINKED = 1;
+const int NODE_REMOVED = 2;
+
+// Node represents a key-value pair in the Skip List
+// It is SkipList's Node, except that every next pointer is atomic
+template <class K, class V>
+struct Node
+{
+    // Holds the key of the Node
+    K key;
+
+    // Holds the value of the Node
+    V value;
+
+    // Holds the number of levels the Node is on
+    int height;
+
+    // Point to the next Node on each level, with REMOVED_MARK
+    // set once the Node is being removed from that level
+    atomic<uintptr_t> *next;
+
+    // One of NODE_LINKING, NODE_LINKED or NODE_REMOVED
+    atomic<int> state;
+
+    // Constructor
+    Node(K k, V v, int h)
+    {
+        this->key = k;
+        this->value = v;
+        this->height = h;
+
+        this->next = new atomic<uintptr_t>[h];
+
+        for (int i = 0; i < h; i++)
+            this->next[i].store(0, memory_order_relaxed);
+
+        this->state.store(NODE_LINKING, memory_order_relaxed);
+    }
+
+    // Destructor
+    ~Node()
+    {
+        delete[] next;
+    }
+};
+
+// Represents a lock-free Skip List
+//
+// Any number of threads can insert(), erase() and read at once.
+// A Node is removed by first marking its next pointers (top level
+// first, the bottom level last), which stops anyone from linking
+// anything after it, and then unlinking ("snipping") it from each
+// level. Every search snips the marked Nodes it walks over.
+//
+// Removed Nodes are retired to the EpochReclaimer, since a reader
+// may still be looking at them. Every method reads the List inside
+// an EpochReclaimer::Guard, and so does every Iterator
+template <class K, class V>
+class ConcurrentSkipList
+{
+    // Holds the most levels a Node can be on
+    static const int MAX_LEVEL = 24;
+
+    // Points to the Dummy Head, which is on every level
+    Node<K, V> *head;
+
+    // Holds the number of Nodes
+    atomic<long> count;
+
+    // Returns the Node a next pointer points to
+    static Node<K, V> *pointerOf(uintptr_t link)
+    {
+        return (Node<K, V> *)(link & ~REMOVED_MARK);
+    }
+
+    // Tells if a next pointer is marked
+    static bool isMarked(uintptr_t link)
+    {
+        return link & REMOVED_MARK;
+    }
+
+    // Returns the height of a new Node
+    // Each level is reached by a quarter of the Nodes below it
+    static int randomHeight()
+    {
+        // Every thread has its own xorshift64 state
+        thread_local uint64_t randomState = hash<thread::id>()(this_thread::get_id()) | 1;
+
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+
+        uint64_t bits = randomState;
+        int height = 1;
+
+        while (height < MAX_LEVEL && !(bits & 3))
+        {
+            height++;
+            bits >>= 2;
+        }
+
+        return height;
+    }
+
+    // Walks right on one level from predecessor to the first Node
+    // that is not before key, snipping marked Nodes on the way
+    // Returns false if predecessor was changed under it
+    bool searchLevel(int level, K key, Node<K, V> *&predecessor, Node<K, V> *&current)
+    {
+        current = pointerOf(predecessor->next[level].load(memory_order_acquire));
+
+        while (current)
+        {
+            uintptr_t successor = current->next[level].load(memory_order_acquire);
+
+            // current is being removed, snip it out of this level
+            if (isMarked(successor))
+            {
+                uintptr_t expected = (uintptr_t)current;
+
+                if (!predecessor->next[level].compare_exchange_strong(expected, successor & ~REMOVED_MARK,
+                                                                      memory_order_acq_rel))
+                    return false;
+
+                current = pointerOf(successor);
+                continue;
+            }
+
+            if (!(current->key < key))
+                break;
+
+            predecessor = current;
+            current = pointerOf(successor);
+        }
+
+        return true;
+    }
+
+    // Finds the last Node before key, and the Node after it, on every level
+    // Returns true if successors[0] holds key
+    bool findNodes(K key, Node<K, V> **predecessors, Node<K, V> **successors)
+    {
+        bool restart = true;
+
+        while (restart)
+        {
+            restart = false;
+
+            Node<K, V> *predecessor = head;
+            Node<K, V> *current = nullptr;
+
+            for (int i = MAX_LEVEL - 1; i >= 0 && !restart; i--)
+            {
+                // Someone changed the List under us, start over
+                if (!searchLevel(i, key, predecessor, current))
+                    restart = true;
+
+                predecessors[i] = predecessor;
+                successors[i] = current;
+            }
+        }
+
+        return successors[0] && !(key < successors[0]->key);
+    }
+
+    // Returns the first Node that is not before key
+    // Only reads, marked Nodes are stepped over but not snipped
+    Node<K, V> *findFirstNotBefore(K key)
+    {
+        Node<K, V> *predecessor = head;
+        Node<K, V> *current = nullptr;
+
+        for (int i = MAX_LEVEL - 1; i >= 0; i--)
+        {
+            current = pointerOf(predecessor->next[i].load(memory_order_acquire));
+
+            while (current)
+            {
+                uintptr_t successor = current->next[i].load(memory_order_acquire);
+
+                // Step over Nodes being removed
+                if (isMarked(successor))
+                {
+                    current = pointerOf(successor);
+                    continue;
+                }
+
+                if (!(current->key < key))
+                    break;
+
+                predecessor = current;
+                current = pointerOf(successor);
+            }
+        }
+
+        return current;
+    }
+
+public:
+    // Points at a Node of the Skip List, or past the last one
+    // Nodes removed while iterating may or may not be seen
+    class Iterator
+    {
+        // Keeps the Nodes from being freed under the Iterator
+        EpochReclaimer::Guard guard;
+
+        // Points to the Node, nullptr past the last one
+        Node<K, V> *node;
+
+    public:
+        // Constructor
+        Iterator(Node<K, V> *node)
+        {
+            this->node = node;
+        }
+
+        const K &key()
+        {
+            return node->key;
+        }
+
+        const V &value()
+        {
+            return node->value;
+        }
+
+        // Moves to the next Node that is not being removed
+        Iterator &operator++()
+        {
+            do
+            {
+                node = pointerOf(node->next[0].load(memory_order_acquire));
+            } while (node && isMarked(node->next[0].load(memory_order_acquire)));
+
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return node != other.node;
+        }
+    };
+
+    // Constructor
+    ConcurrentSkipList()
+    {
+        // The Dummy Head holds the default key and value of a type
+        head = new Node<K, V>(K(), V(), MAX_LEVEL);
+        head->state.store(NODE_LINKED, memory_order_relaxed);
+
+        count.store(0, memory_order_relaxed);
+    }
+
+    // Threads may still be using the List, so it can't be copied
+    ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+    ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+    // Destructor
+    // No other thread may be using the List by now
+    ~ConcurrentSkipList()
+    {
+        clear();
+        delete head;
+    }
+
+    // Adds a key-value pair to the Skip List
+    // Returns false if the key is already there
+    bool insert(K key, V value)
+    {
+        EpochReclaimer::Guard guard;
+
+        Node<K, V> *predecessors[MAX_LEVEL];
+        Node<K, V> *successors[MAX_LEVEL];
+
+        int height = randomHeight();
+        Node<K, V> *newNode = nullptr;
+
+        // Link the new Node on the bottom level
+        // This is where it becomes part of the List
+        while (true)
+        {
+            // Key found
+            if (findNodes(key, predecessors, successors))
+            {
+                delete newNode;
+                return false;
+            }
+
+            if (!newNode)
+                newNode = new Node<K, V>(key, value, height);
+
+            for (int i = 0; i < height; i++)
+                newNode->next[i].store((uintptr_t)successors[i], memory_order_relaxed);
+
+            uintptr_t expected = (uintptr_t)successors[0];
+
+            if (predecessors[0]->next[0].compare_exchange_strong(expected, (uintptr_t)newNode,
+                                                                 memory_order_release, memory_order_relaxed))
+                break;
+        }
+
+        count.fetch_add(1, memory_order_relaxed);
+
+        // Link the new Node on its upper levels
+        bool linking = true;
+
+        for (int i = 1; i < height && linking; i++)
+        {
+            while (true)
+            {
+                uintptr_t link = newNode->next[i].load(memory_order_acquire);
+
+                // The Node is already being removed, stop linking it
+                if (isMarked(link))
+                {
+                    linking = false;
+                    break;
+                }
+
+                // Point the Node at its current successor on this level
+                if (pointerOf(link) != successors[i] &&
+                    !newNode->next[i].compare_exchange_strong(link, (uintptr_t)successors[i], memory_order_acq_rel))
+                    continue;
+
+                uintptr_t expected = (uintptr_t)successors[i];
+
+                if (predecessors[i]->next[i].compare_exchange_strong(expected, (uintptr_t)newNode,
+                                                                     memory_order_release, memory_order_relaxed))
+                    break;
+
+                // The level changed, look again
+                findNodes(key, predecessors, successors);
+
+                // The Node has already been removed
+                if (successors[0] != newNode)
+                {
+                    linking = false;
+                    break;
+                }
+            }
+        }
+
+        // If an eraser marked the Node while it was being linked
+        // it left freeing the Node to us
+        int state = NODE_LINKING;
+
+        if (!newNode->state.compare_exchange_strong(state, NODE_LINKED, memory_order_acq_rel))
+        {
+            // Snip it out of every level we may have linked it on
+            findNodes(key, predecessors, successors);
+            EpochReclaimer::retire(newNode);
+        }
+
+        return true;
+    }
+
+    // Gets the value of a key from the Skip List
+    bool get(K key, V &value)
+    {
+        EpochReclaimer::Guard guard;
+        Node<K, V> *found = findFirstNotBefore(key);
+
+        // No such key in the Skip List
+        if (!found || key < found->key)
+            return false;
+
+        value = found->value;
+        return true;
+    }
+
+    // Tells if a key is in the Skip List
+    bool contains(K key)
+    {
+        EpochReclaimer::Guard guard;
+        Node<K, V> *found = findFirstNotBefore(key);
+
+        return found && !(key < found->key);
+    }
+
+    // Returns an Iterator to the first Node whose key is not before key
+    Iterator lowerBound(K key)
+    {
+        EpochReclaimer::Guard guard;
+        return Iterator(findFirstNotBefore(key));
+    }
+
+    // Returns an Iterator to the first Node
+    Iterator begin()
+    {
+        Iterator first(head);
+        return ++first;
+    }
+
+    // Returns an Iterator past the last Node
+    Iterator end()
+    {
+        return Iterator(nullptr);
+    }
+
+    // Removes a key-value pair from the Skip List
+    bool erase(K key)
+    {
+        EpochReclaimer::Guard guard;
+
+        Node<K, V> *predecessors[MAX_LEVEL];
+        Node<K, V> *successors[MAX_LEVEL];
+
+        // No such key in the Skip List
+        if (!findNodes(key, predecessors, successors))
+            return false;
+
+        Node<K, V> *victim = successors[0];
+
+        // Mark the upper levels, top down
+        for (int i = victim->height - 1; i >= 1; i--)
+        {
+            uintptr_t link = victim->next[i].load(memory_order_acquire);
+
+            while (!isMarked(link) &&
+                   !victim->next[i].compare_exchange_weak(link, link | REMOVED_MARK, memory_order_acq_rel))
+                ;
+        }
+
+        // Marking the bottom level is what removes the Node
+        uintptr_t link = victim->next[0].load(memory_order_acquire);
+
+        while (true)
+        {
+            // Another thread removed it first
+            if (isMarked(link))
+                return false;
+
+            if (victim->next[0].compare_exchange_weak(link, link | REMOVED_MARK, memory_order_acq_rel))
+                break;
+        }
+
+        count.fetch_sub(1, memory_order_relaxed);
+
+        // If the inserter is still linking the Node, it may link it on
+        // another level after we are done snipping, so leave it the job
+        int state = NODE_LINKING;
+
+        if (victim->state.compare_exchange_strong(state, NODE_REMOVED, memory_order_acq_rel))
+            return true;
+
+        // Else the Node is on every level it will ever be on
+        // Snip it out of all of them, and retire it
+        findNodes(key, predecessors, successors);
+        EpochReclaimer::retire(victim);
+
+        return true;
+    }
+
+    // Returns the number of key-value pairs
+    long size()
+    {
+        return count.load(memory_order_relaxed);
+    }
+
+    // Prints the Skip List in key order
+    void printForward()
+    {
+        for (Iterator current = begin(); current != end(); ++current)
+            cout << "[" << current.key() << " : " << current.value() << "] ";
+
+        cout << endl;
+    }
+
+    // Clears the entire Skip List
+    // No other thread may be using the List
+    int clear()
+    {
+        int counter = 0;
+
+        // Every Node still in the List is on the bottom level
+        for (Node<K, V> *current = pointerOf(head->next[0].load()), *next; current; current = next)
+        {
+            next = pointerOf(current->next[0].load());
+
+            delete current;
+            counter++;
+        }
+
+        for (int i = 0; i < MAX_LEVEL; i++)
+            head->next[i].store(0);
+
+        count.store(0);
+
+        return counter;
+    }
+};
+
+int main()
+{
+    // Create a new Skip List
+    ConcurrentSkipList<int, string> list;
+
+    // Let 4 threads insert 1000 keys each, and then erase the even ones
+    vector<thread> workers;
+
+    for (int t = 0; t < 4; t++)
+    {
+        workers.push_back(thread([&list, t]
+                                 {
+            for (int key = t; key < 4000; key += 4)
+                list.insert(key, to_string(key * key));
+
+            for (int key = t; key < 4000; key += 4)
+                if (!(key % 2))
+                    list.erase(key); }));
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    cout << list.size() << endl;
+
+    string result;
+    if (list.get(21, result))
+        cout << result << endl;
+
+    // Print every key from 10 upto (not including) 20
+    for (auto current = list.lowerBound(10); current != list.end() && current.key() < 20; ++current)
+        cout << current.key() << " ";
+    cout << endl;
+
+    cout << list.clear() << endl;
+
+    return 0;
+}
@@ -9,15 +9,26 @@
  * --------------------------------------------------------------------------------
  *
  * Revision History :
+ * 2026-October-19	[AG] : Chunked streams come from ChunkStream.h
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Added serialize() and deserialize()
  * 2020-August-12	[SP] : Added clear() and tweaked printForward()
  * 2020-August-01	[SP] : Created
  * --------------------------------------------------------------------------------
  */
 
 #include <iostream>
+#include <string>
+#include <sstream>
+#include <cstdint>
+
+#include "../Serialization/ChunkStream.h"
 
 using namespace std;
 
+// Marks the start of a serialized List ("LST1")
+const uint32_t LIST_MAGIC = 0x3154534C;
+
 // Node represents a value in the List
 struct Node
 {
@@ -58,6 +69,43 @@ public:
         head = tail = nullptr;
     }
 
+    // Copy Constructor
+    // The copy gets Nodes of its own
+    DoubleLinkedList(const DoubleLinkedList &other) : DoubleLinkedList()
+    {
+        for (Node *current = other.head; current; current = current->next)
+            pushBack(current->value);
+    }
+
+    // Move Constructor
+    // Takes other's Nodes, leaving it empty
+    DoubleLinkedList(DoubleLinkedList &&other) noexcept : DoubleLinkedList()
+    {
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the List moved from),
+    // so its Nodes are taken and ours go away with it
+    DoubleLinkedList &operator=(DoubleLinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~DoubleLinkedList()
+    {
+        clear();
+    }
+
+    // Trades Nodes with another List
+    void swap(DoubleLinkedList &other) noexcept
+    {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+    }
+
     // Method to add a Node at the Back of the List
     void pushBack(int value)
     {
@@ -151,6 +199,34 @@ public:
         return false;
     }
 
+    // Writes the List to a stream in binary chunks
+    bool serialize(ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, LIST_MAGIC, checksummed);
+
+        // Write the values from the Head upto the Tail
+        for (Node *current = head; current; current = current->next)
+        {
+            writer.write(current->value);
+            writer.endRecord();
+        }
+
+        return writer.finish();
+    }
+
+    // Reads values written by serialize()
+    // and adds them at the Back of the List
+    bool deserialize(istream &in)
+    {
+        ChunkReader reader(in, LIST_MAGIC);
+        int value;
+
+        while (reader.nextRecord() && reader.read(value))
+            pushBack(value);
+
+        return reader.succeeded();
+    }
+
     // Method to print the List in Forward Direction
     void printForward()
     {
@@ -213,6 +289,15 @@ int main()
         list.printForward();
     }
 
+    // Round trip the List through a binary stream
+    stringstream stream;
+    list.serialize(stream, true);
+
+    DoubleLinkedList copy;
+    copy.deserialize(stream);
+    copy.printForward();
+    copy.clear();
+
     while (cout << "Enter value to remove from the List (0 to stop) : ",
            cin >> value,
            value)
@@ -9,15 +9,40 @@
  * --------------------------------------------------------------------------------
  * 
  * Revision History : 
+ * 2026-October-19	[AG] : main times sort() against a vector and std::sort
+ * 2026-October-19	[AG] : serialize() writes trivially copyable values in batches
+ * 2026-October-19	[AG] : Chunked streams come from ChunkStream.h
+ * 2026-October-19	[AG] : Added forEachParallel(), reduceParallel() and countIf()
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Added splice(), merge() and splitAt()
+ * 2026-October-19	[AG] : Added sort()
+ * 2026-October-19	[AG] : Added serialize() and deserialize()
  * 2020-August-12	[SP] : Created
  * --------------------------------------------------------------------------------
  */
 
 #include <iostream>
 #include <string>
+#include <sstream>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+#include "../Concurrency/Parallel.h"
+#include "../Serialization/ChunkStream.h"
 
 using namespace std;
 
+// Marks the start of a serialized List ("LST1")
+const uint32_t LIST_MAGIC = 0x3154534C;
+
+// Holds the number of Nodes in each chunk of a parallel loop
+const int PARALLEL_CHUNK_NODES = 4096;
+
 // Node represents a value in the List
 template <class V>
 struct Node
@@ -32,10 +57,10 @@ struct Node
     Node<V> *next;
 
     // Constructor
-    Node(V v)
+    // The value is moved in, not made empty and then assigned
+    Node(V v) : value(std::move(v))
     {
         previous = next = nullptr;
-        (*this).value = v;
     }
 };
 
@@ -43,28 +68,226 @@ struct Node
 template <class V>
 class SentinelLinkedList
 {
+    // The Dummy Nodes live inside the List object,
+    // so that no List is ever without them
+    Node<V> dummyHead;
+    Node<V> dummyTail;
+
     // Points to the Dummy Head
     Node<V> *head;
 
     // Points to the Dummy Tail
     Node<V> *tail;
 
+    // Merges two sorted chains of Nodes (ended by nullptr) into one
+    // Equal values keep their order, first's before second's
+    template <class Compare>
+    static Node<V> *mergeChains(Node<V> *first, Node<V> *second, Compare &compare)
+    {
+        Node<V> *merged = nullptr;
+        Node<V> **link = &merged;
+
+        // Keep linking the smaller front Node
+        while (first && second)
+        {
+            if (compare(second->value, first->value))
+            {
+                *link = second;
+                second = second->next;
+            }
+            else
+            {
+                *link = first;
+                first = first->next;
+            }
+
+            link = &(*link)->next;
+        }
+
+        // Link whatever is left
+        *link = first ? first : second;
+
+        return merged;
+    }
+
+    // Cuts the next sorted run off the front of a chain
+    // A strictly descending run is reversed on the way
+    template <class Compare>
+    static Node<V> *takeRun(Node<V> *&chain, Compare &compare)
+    {
+        Node<V> *run = chain;
+        Node<V> *last = chain;
+
+        // A strictly descending run
+        if (last->next && compare(last->next->value, last->value))
+        {
+            chain = last->next;
+            run->next = nullptr;
+
+            // Move each smaller Node to the front of the run
+            while (chain && compare(chain->value, run->value))
+            {
+                Node<V> *node = chain;
+                chain = chain->next;
+
+                node->next = run;
+                run = node;
+            }
+
+            return run;
+        }
+
+        // An ascending run
+        while (last->next && !compare(last->next->value, last->value))
+            last = last->next;
+
+        chain = last->next;
+        last->next = nullptr;
+
+        return run;
+    }
+
+    // Sorts a chain of Nodes (ended by nullptr) by relinking them
+    //
+    // Runs that are already sorted are taken whole and merged
+    // bottom up: runs[i] holds a merge of about 2^i runs, and
+    // each new run is carried up like adding 1 to a binary number
+    template <class Compare>
+    static Node<V> *sortChain(Node<V> *chain, Compare &compare)
+    {
+        Node<V> *runs[64] = {};
+
+        while (chain)
+        {
+            Node<V> *run = takeRun(chain, compare);
+
+            // Carry the run up through the occupied slots
+            // (older runs always go first, to keep the sort stable)
+            int i = 0;
+            for (; i < 63 && runs[i]; i++)
+            {
+                run = mergeChains(runs[i], run, compare);
+                runs[i] = nullptr;
+            }
+
+            runs[i] = runs[i] ? mergeChains(runs[i], run, compare) : run;
+        }
+
+        // Merge every slot that is left, newest runs first
+        Node<V> *sorted = nullptr;
+
+        for (int i = 0; i < 64; i++)
+        {
+            if (runs[i])
+                sorted = mergeChains(runs[i], sorted, compare);
+        }
+
+        return sorted;
+    }
+
+    // Unlinks the Nodes from first upto last (both included)
+    // The dummy Nodes are never part of the range
+    static void unlinkRange(Node<V> *first, Node<V> *last)
+    {
+        first->previous->next = last->next;
+        last->next->previous = first->previous;
+
+        first->previous = nullptr;
+        last->next = nullptr;
+    }
+
+    // Links a chain of Nodes from first upto last in before position
+    static void linkRange(Node<V> *position, Node<V> *first, Node<V> *last)
+    {
+        first->previous = position->previous;
+        last->next = position;
+
+        position->previous->next = first;
+        position->previous = last;
+    }
+
+    // Makes the chain of Nodes from first upto last this List's Nodes
+    // (nullptr for an empty chain)
+    void relink(Node<V> *first, Node<V> *last)
+    {
+        head->next = tail;
+        tail->previous = head;
+
+        if (first)
+            linkRange(tail, first, last);
+    }
+
+    // Calls function(value) for every Node of a chunk,
+    // which ends where the next one starts (at the dummy tail for the last)
+    template <class Function>
+    void walkChunk(const vector<Node<V> *> &index, int chunk, Function function)
+    {
+        Node<V> *end = chunk + 1 < (int)index.size() ? index[chunk + 1] : tail;
+
+        for (Node<V> *current = index[chunk]; current != end; current = current->next)
+            function(current->value);
+    }
+
 public:
     // Constructor
-    SentinelLinkedList()
+    // The dummy Nodes hold the default value of a type
+    // (invokes the Default Constructor of a type
+    // SWEET C++
+    SentinelLinkedList() : dummyHead(V()), dummyTail(V())
     {
-        // Create dummy Nodes
-        // of default value of a type
-        // (invokes the Default Constructor of a type
-        // SWEET C++
-        head = new Node<V>(V());
-        tail = new Node<V>(V());
+        head = &dummyHead;
+        tail = &dummyTail;
 
         // Point head and tail to each other
         head->next = tail;
         tail->previous = head;
     }
 
+    // Copy Constructor
+    // The copy gets Nodes of its own
+    SentinelLinkedList(const SentinelLinkedList &other) : SentinelLinkedList()
+    {
+        for (Node<V> *current = other.head->next; current != other.tail; current = current->next)
+            pushBack(current->value);
+    }
+
+    // Move Constructor
+    // Takes other's Nodes, leaving it empty
+    SentinelLinkedList(SentinelLinkedList &&other) noexcept : SentinelLinkedList()
+    {
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the List moved from),
+    // so its Nodes are taken and ours go away with it
+    SentinelLinkedList &operator=(SentinelLinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~SentinelLinkedList()
+    {
+        clear();
+    }
+
+    // Trades Nodes with another List
+    // Each List keeps its own dummy Nodes, only the
+    // first and last real Nodes are relinked to the other's
+    void swap(SentinelLinkedList &other) noexcept
+    {
+        Node<V> *first = head->next != tail ? head->next : nullptr;
+        Node<V> *last = tail->previous;
+
+        Node<V> *otherFirst = other.head->next != other.tail ? other.head->next : nullptr;
+        Node<V> *otherLast = other.tail->previous;
+
+        relink(otherFirst, otherLast);
+        other.relink(first, last);
+    }
+
     // Method to add a Node in the Linked List
     void pushBack(V value)
     {
@@ -126,6 +349,298 @@ public:
         return false;
     }
 
+    // Points at a Node of the List, or at the dummy tail
+    class Iterator
+    {
+        // Points to the Node
+        Node<V> *node;
+
+        friend class SentinelLinkedList;
+
+    public:
+        // Constructor
+        Iterator(Node<V> *node)
+        {
+            this->node = node;
+        }
+
+        V &operator*()
+        {
+            return node->value;
+        }
+
+        V *operator->()
+        {
+            return &node->value;
+        }
+
+        Iterator &operator++()
+        {
+            node = node->next;
+            return *this;
+        }
+
+        Iterator &operator--()
+        {
+            node = node->previous;
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return node != other.node;
+        }
+    };
+
+    // Returns an Iterator to the first Node
+    Iterator begin()
+    {
+        return Iterator(head->next);
+    }
+
+    // Returns an Iterator to the dummy tail
+    Iterator end()
+    {
+        return Iterator(tail);
+    }
+
+    // Returns an Iterator to the first Node holding value
+    // or end() if there is none
+    Iterator find(V value)
+    {
+        Node<V> *current = head->next;
+
+        while (current != tail && !(current->value == value))
+            current = current->next;
+
+        return Iterator(current);
+    }
+
+    // Sorts the List by relinking its Nodes, without allocating
+    template <class Compare = less<V>>
+    void sort(Compare compare = Compare())
+    {
+        // Nothing to sort
+        if (head->next == tail || head->next->next == tail)
+            return;
+
+        // Detach the Nodes from the dummy tail
+        tail->previous->next = nullptr;
+
+        Node<V> *sorted = sortChain(head->next, compare);
+
+        // Link the Nodes back between the dummies
+        // fixing the previous pointers on the way
+        Node<V> *previous = head;
+
+        for (Node<V> *current = sorted; current; current = current->next)
+        {
+            current->previous = previous;
+            previous->next = current;
+            previous = current;
+        }
+
+        previous->next = tail;
+        tail->previous = previous;
+    }
+
+    // Moves every Node of other in before position
+    // Nothing is allocated or copied
+    void splice(Iterator position, SentinelLinkedList &other)
+    {
+        if (&other != this)
+            splice(position, other, other.begin(), other.end());
+    }
+
+    // Moves the Nodes of other from first upto (not including) last
+    // in before position. position must not be in the moved range
+    void splice(Iterator position, SentinelLinkedList &, Iterator first, Iterator last)
+    {
+        // Nothing to move
+        if (first == last)
+            return;
+
+        Node<V> *lastNode = last.node->previous;
+
+        unlinkRange(first.node, lastNode);
+        linkRange(position.node, first.node, lastNode);
+    }
+
+    // Moves every Node of a sorted List into this sorted List
+    // keeping it sorted. Equal values from this List go first
+    template <class Compare = less<V>>
+    void merge(SentinelLinkedList &other, Compare compare = Compare())
+    {
+        // Nothing to merge
+        if (&other == this || other.head->next == other.tail)
+            return;
+
+        // Detach the real Nodes of both Lists from their dummies
+        Node<V> *otherFirst = other.head->next;
+        unlinkRange(otherFirst, other.tail->previous);
+
+        Node<V> *first = nullptr;
+        if (head->next != tail)
+        {
+            first = head->next;
+            unlinkRange(first, tail->previous);
+        }
+
+        Node<V> *merged = mergeChains(first, otherFirst, compare);
+
+        // Link the Nodes back between the dummies
+        // fixing the previous pointers on the way
+        Node<V> *previous = head;
+
+        for (Node<V> *current = merged; current; current = current->next)
+        {
+            current->previous = previous;
+            previous->next = current;
+            previous = current;
+        }
+
+        previous->next = tail;
+        tail->previous = previous;
+    }
+
+    // Moves the Nodes from position upto the dummy tail to the Back of rest
+    void splitAt(Iterator position, SentinelLinkedList &rest)
+    {
+        rest.splice(rest.end(), *this, position, end());
+    }
+
+    // Returns the Nodes from position upto the dummy tail as a List of their own
+    SentinelLinkedList splitAt(Iterator position)
+    {
+        SentinelLinkedList rest;
+        splitAt(position, rest);
+
+        return rest;
+    }
+
+    // Writes the List to a stream in binary chunks
+    bool serialize(ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, LIST_MAGIC, checksummed);
+
+        // Trivially copyable values are laid out in a batch,
+        // which is added to the stream a chunk at a time
+        constexpr bool BULK = is_trivially_copyable<V>::value;
+        string batch;
+
+        // Write the values from the Head upto the Tail
+        for (Node<V> *current = head->next; current != tail; current = current->next)
+        {
+            if constexpr (BULK)
+            {
+                batch.append((const char *)&current->value, sizeof(V));
+
+                if (batch.size() >= SERIALIZE_CHUNK_SIZE)
+                {
+                    writer.writeRecords(batch.data(), batch.size() / sizeof(V), sizeof(V));
+                    batch.clear();
+                }
+            }
+            else
+            {
+                writer.write(current->value);
+                writer.endRecord();
+            }
+        }
+
+        writer.writeRecords(batch.data(), batch.size() / sizeof(V), sizeof(V));
+
+        return writer.finish();
+    }
+
+    // Reads values written by serialize()
+    // and adds them at the Back of the List
+    bool deserialize(istream &in)
+    {
+        ChunkReader reader(in, LIST_MAGIC);
+        V value;
+
+        while (reader.nextRecord() && reader.read(value))
+            pushBack(value);
+
+        return reader.succeeded();
+    }
+
+    // Marks the first Node of every chunk of the List,
+    // so that each thread starts at its chunk instead of walking to it
+    using ChunkIndex = vector<Node<V> *>;
+
+    // Builds a ChunkIndex in one walk of the List
+    // It holds until a Node is added or removed, so a List that
+    // doesn't change can be split once for many parallel loops
+    ChunkIndex chunkIndex(int nodesPerChunk = PARALLEL_CHUNK_NODES)
+    {
+        ChunkIndex index;
+        int i = 0;
+
+        for (Node<V> *current = head->next; current != tail; current = current->next, i++)
+        {
+            if (i % nodesPerChunk == 0)
+                index.push_back(current);
+        }
+
+        return index;
+    }
+
+    // Calls function(value) for every Node, from the Head to the Tail
+    template <class Function>
+    void forEach(Function function)
+    {
+        for (Node<V> *current = head->next; current != tail; current = current->next)
+            function(current->value);
+    }
+
+    // Calls function(value) for every Node, on several threads
+    // Without an index, one is built first
+    // function may change the value, but no thread may change the List
+    template <class Function>
+    void forEachParallel(Function function, const ChunkIndex &index = ChunkIndex())
+    {
+        if (index.empty() && head->next != tail)
+            return forEachParallel(function, chunkIndex());
+
+        parallelFor(index.size(), [&](int chunk)
+                    { walkChunk(index, chunk, function); });
+    }
+
+    // Returns identity combine()d with map(value) of every Node,
+    // computed on several threads
+    // combine() must be associative and identity must leave a value
+    // unchanged, since each chunk starts from identity
+    template <class T, class Map, class Combine>
+    T reduceParallel(T identity, Map map, Combine combine, const ChunkIndex &index = ChunkIndex())
+    {
+        if (index.empty() && head->next != tail)
+            return reduceParallel(identity, map, combine, chunkIndex());
+
+        return parallelReduce(index.size(), identity, [&](int chunk)
+                              {
+            T result = identity;
+
+            walkChunk(index, chunk, [&](const V &value)
+                      { result = combine(result, map(value)); });
+
+            return result; }, combine);
+    }
+
+    // Returns the number of Nodes for which predicate(value) holds
+    template <class Predicate>
+    long countIf(Predicate predicate, const ChunkIndex &index = ChunkIndex())
+    {
+        return reduceParallel(0L, [&](const V &value)
+                              { return predicate(value) ? 1L : 0L; }, plus<long>(), index);
+    }
+
     // Method to print the List in Forward direction
     void printForward()
     {
@@ -169,6 +684,101 @@ public:
     }
 };
 
+// Sums and counts values of a List of n Nodes serially,
+// then in parallel over one ChunkIndex
+void aggregateInParallel(int n)
+{
+    SentinelLinkedList<int> large;
+
+    for (int i = 0; i < n; i++)
+        large.pushBack(i % 1000);
+
+    long serialSum = 0, serialEven = 0;
+    auto start = chrono::steady_clock::now();
+
+    large.forEach([&](int &value)
+                  { serialSum += value; serialEven += value % 2 == 0; });
+
+    auto serial = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    auto index = large.chunkIndex();
+
+    auto indexing = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    long sum = large.reduceParallel(0L, [](const int &value)
+                                    { return (long)value; }, plus<long>(), index);
+    long even = large.countIf([](const int &value)
+                              { return value % 2 == 0; }, index);
+
+    auto parallel = chrono::steady_clock::now() - start;
+
+    cout << "Serial : " << chrono::duration_cast<chrono::microseconds>(serial).count() << " us, "
+         << "chunkIndex() : " << chrono::duration_cast<chrono::microseconds>(indexing).count() << " us, "
+         << "parallel on " << parallelThreads() << " threads : "
+         << chrono::duration_cast<chrono::microseconds>(parallel).count() << " us ("
+         << (sum == serialSum && even == serialEven) << ")" << endl;
+
+    large.forEachParallel([](int &value)
+                          { value++; }, index);
+    cout << large.countIf([](const int &value)
+                          { return value == 1000; }, index)
+         << endl;
+
+    large.clear();
+}
+
+// Times sort() on a List of n scattered values against copying
+// them to a vector, std::sort and writing them back in order
+void sortAgainstVector(int n)
+{
+    SentinelLinkedList<int> relinked;
+    SentinelLinkedList<int> copied;
+
+    for (int i = 0; i < n; i++)
+    {
+        int value = (unsigned)i * 2654435761u % n;
+
+        relinked.pushBack(value);
+        copied.pushBack(value);
+    }
+
+    auto start = chrono::steady_clock::now();
+
+    relinked.sort();
+
+    auto sorting = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    vector<int> values;
+    values.reserve(n);
+
+    copied.forEach([&](int &value)
+                   { values.push_back(value); });
+
+    std::sort(values.begin(), values.end());
+
+    size_t next = 0;
+    copied.forEach([&](int &value)
+                   { value = values[next++]; });
+
+    auto copying = chrono::steady_clock::now() - start;
+
+    // Both Lists must now hold the same values in the same order
+    next = 0;
+    bool same = true;
+    relinked.forEach([&](int &value)
+                     { same = same && value == values[next++]; });
+
+    cout << "sort() : " << chrono::duration_cast<chrono::microseconds>(sorting).count() << " us, "
+         << "vector and std::sort : " << chrono::duration_cast<chrono::microseconds>(copying).count() << " us ("
+         << same << ")" << endl;
+
+    relinked.clear();
+    copied.clear();
+}
+
 int main()
 {
     // Create a new Sentinel List
@@ -184,6 +794,19 @@ int main()
         list.printForward();
     }
 
+    // Round trip the List through a binary stream
+    stringstream stream;
+    list.serialize(stream, true);
+
+    SentinelLinkedList<string> copy;
+    copy.deserialize(stream);
+    copy.printForward();
+    copy.clear();
+
+    // Sort the values
+    list.sort();
+    list.printForward();
+
     while (cout << "Enter value to remove (0 to stop) : ",
            cin >> value,
            value != "n")
@@ -195,5 +818,42 @@ int main()
     cout << list.clear() << endl;
     list.printForward();
 
+    // Move Nodes between Lists without allocating
+    SentinelLinkedList<int> odds;
+    SentinelLinkedList<int> evens;
+
+    for (int i = 1; i <= 9; i += 2)
+        odds.pushBack(i);
+
+    for (int i = 2; i <= 10; i += 2)
+        evens.pushBack(i);
+
+    odds.merge(evens);
+    odds.printForward();
+
+    // Move 6 upto 10 to the front
+    SentinelLinkedList<int> upper;
+
+    odds.splitAt(odds.find(6), upper);
+    odds.splice(odds.begin(), upper);
+    odds.printForward();
+
+    // Lists can be returned and stored by value
+    vector<SentinelLinkedList<int>> halves;
+
+    halves.push_back(odds.splitAt(odds.find(3)));
+    halves.push_back(odds);
+    halves[0].swap(halves[1]);
+    halves[0].printForward();
+    halves[1].printForward();
+
+    cout << odds.clear() << endl;
+
+    // Aggregate a big List serially and on every core
+    aggregateInParallel(2000000);
+
+    // Sort a big List in place and through a vector
+    sortAgainstVector(1000000);
+
     return 0;
 }
\ No newline at end of file
@@ -9,6 +9,14 @@
  * --------------------------------------------------------------------------------
  * 
  * Revision History : 
+ * 2026-October-19	[AG] : main times sort() against a vector and std::sort
+ * 2026-October-19	[AG] : serialize() writes trivially copyable values in batches
+ * 2026-October-19	[AG] : Chunked streams come from ChunkStream.h
+ * 2026-October-19	[AG] : Added forEachParallel(), reduceParallel() and countIf()
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Added sort()
+ * 2026-October-19	[AG] : First Nodes can live inside the List object
+ * 2026-October-19	[AG] : Added serialize() and deserialize()
  * 2020-August-12	[SP]: Made correction in struct Node
  * 2020-August-12	[SP] : Created
  * --------------------------------------------------------------------------------
@@ -16,9 +24,27 @@
 
 #include <iostream>
 #include <string>
+#include <sstream>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <new>
+
+#include "../Concurrency/Parallel.h"
+#include "../Serialization/ChunkStream.h"
 
 using namespace std;
 
+// Marks the start of a serialized List ("LST1")
+const uint32_t LIST_MAGIC = 0x3154534C;
+
+// Holds the number of Nodes in each chunk of a parallel loop
+const int PARALLEL_CHUNK_NODES = 4096;
+
 // Node represents a value in the Link List
 template <class V>
 struct Node
@@ -30,15 +56,86 @@ struct Node
     Node<V> *next;
 
     // Constructor
-    Node(V v)
+    // The value is moved in, not made empty and then assigned
+    Node(V v) : value(std::move(v))
     {
-        this->value = v;
         this->next = nullptr;
     }
 };
 
-// Represents a Single Linked List
+// Holds the first N Nodes of a List inside the List object itself,
+// so that a List of upto N values never allocates
+template <class V, size_t N>
+class InlineNodePool
+{
+    static_assert(N <= 64, "A List can hold at most 64 inline Nodes");
+
+    // Raw memory for the Nodes
+    alignas(Node<V>) unsigned char storage[N][sizeof(Node<V>)];
+
+    // Bit i is set while storage[i] holds a Node
+    uint64_t taken;
+
+public:
+    // Constructor
+    InlineNodePool()
+    {
+        taken = 0;
+    }
+
+    // Returns memory for a Node, or nullptr if every slot is taken
+    void *allocate()
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            if (!(taken & (1ull << i)))
+            {
+                taken |= (1ull << i);
+                return storage[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Tells if a Node lives in this pool
+    bool owns(Node<V> *node)
+    {
+        uintptr_t address = (uintptr_t)node;
+
+        return address >= (uintptr_t)storage[0] && address < (uintptr_t)(storage + N);
+    }
+
+    // Gives a Node's slot back to the pool
+    void release(Node<V> *node)
+    {
+        taken &= ~(1ull << (((uintptr_t)node - (uintptr_t)storage[0]) / sizeof(Node<V>)));
+    }
+};
+
+// Without inline Nodes every Node comes from the heap
 template <class V>
+class InlineNodePool<V, 0>
+{
+public:
+    void *allocate()
+    {
+        return nullptr;
+    }
+
+    bool owns(Node<V> *)
+    {
+        return false;
+    }
+
+    void release(Node<V> *)
+    {
+    }
+};
+
+// Represents a Single Linked List
+// The first InlineNodes Nodes live inside the List object
+template <class V, size_t InlineNodes = 0>
 class SingleLinkedList
 {
     // Points to the Head of a List
@@ -47,6 +144,189 @@ class SingleLinkedList
     // Points to the Tail of a List
     Node<V> *tail;
 
+    // Holds the first InlineNodes Nodes of the List
+    InlineNodePool<V, InlineNodes> inlineNodes;
+
+    // Creates a Node, inside the List object while there is room
+    Node<V> *createNode(V value)
+    {
+        void *slot = inlineNodes.allocate();
+
+        if (slot)
+            return new (slot) Node<V>(value);
+
+        return new Node<V>(value);
+    }
+
+    // Destroys a Node made by createNode()
+    void destroyNode(Node<V> *node)
+    {
+        if (inlineNodes.owns(node))
+        {
+            node->~Node<V>();
+            inlineNodes.release(node);
+        }
+        else
+            delete node;
+    }
+
+    // Moving a List only moves values when it has inline Nodes
+    static constexpr bool NOTHROW_MOVE = !InlineNodes || is_nothrow_move_constructible<V>::value;
+
+    // Takes over the Nodes of another List, leaving it empty
+    // (this List must be empty)
+    //
+    // Heap Nodes just change hands. Nodes in other's inline
+    // storage can't leave it, so their values are moved into this
+    // List's own inline storage, which is O(InlineNodes)
+    void takeNodes(SingleLinkedList &other) noexcept(NOTHROW_MOVE)
+    {
+        head = other.head;
+        tail = other.tail;
+        other.head = other.tail = nullptr;
+
+        if constexpr (InlineNodes > 0)
+        {
+            for (Node<V> *current = head, *previous = nullptr; current; previous = current, current = current->next)
+            {
+                if (!other.inlineNodes.owns(current))
+                    continue;
+
+                Node<V> *moved = createNode(std::move(current->value));
+                moved->next = current->next;
+
+                // Put moved in current's place
+                if (previous)
+                    previous->next = moved;
+                else
+                    head = moved;
+
+                if (tail == current)
+                    tail = moved;
+
+                other.destroyNode(current);
+                current = moved;
+            }
+        }
+    }
+
+    // Merges two sorted chains of Nodes (ended by nullptr) into one
+    // Equal values keep their order, first's before second's
+    template <class Compare>
+    static Node<V> *mergeChains(Node<V> *first, Node<V> *second, Compare &compare)
+    {
+        Node<V> *merged = nullptr;
+        Node<V> **link = &merged;
+
+        // Keep linking the smaller front Node
+        while (first && second)
+        {
+            if (compare(second->value, first->value))
+            {
+                *link = second;
+                second = second->next;
+            }
+            else
+            {
+                *link = first;
+                first = first->next;
+            }
+
+            link = &(*link)->next;
+        }
+
+        // Link whatever is left
+        *link = first ? first : second;
+
+        return merged;
+    }
+
+    // Cuts the next sorted run off the front of a chain
+    // A strictly descending run is reversed on the way
+    template <class Compare>
+    static Node<V> *takeRun(Node<V> *&chain, Compare &compare)
+    {
+        Node<V> *run = chain;
+        Node<V> *last = chain;
+
+        // A strictly descending run
+        if (last->next && compare(last->next->value, last->value))
+        {
+            chain = last->next;
+            run->next = nullptr;
+
+            // Move each smaller Node to the front of the run
+            while (chain && compare(chain->value, run->value))
+            {
+                Node<V> *node = chain;
+                chain = chain->next;
+
+                node->next = run;
+                run = node;
+            }
+
+            return run;
+        }
+
+        // An ascending run
+        while (last->next && !compare(last->next->value, last->value))
+            last = last->next;
+
+        chain = last->next;
+        last->next = nullptr;
+
+        return run;
+    }
+
+    // Sorts a chain of Nodes (ended by nullptr) by relinking them
+    //
+    // Runs that are already sorted are taken whole and merged
+    // bottom up: runs[i] holds a merge of about 2^i runs, and
+    // each new run is carried up like adding 1 to a binary number
+    template <class Compare>
+    static Node<V> *sortChain(Node<V> *chain, Compare &compare)
+    {
+        Node<V> *runs[64] = {};
+
+        while (chain)
+        {
+            Node<V> *run = takeRun(chain, compare);
+
+            // Carry the run up through the occupied slots
+            // (older runs always go first, to keep the sort stable)
+            int i = 0;
+            for (; i < 63 && runs[i]; i++)
+            {
+                run = mergeChains(runs[i], run, compare);
+                runs[i] = nullptr;
+            }
+
+            runs[i] = runs[i] ? mergeChains(runs[i], run, compare) : run;
+        }
+
+        // Merge every slot that is left, newest runs first
+        Node<V> *sorted = nullptr;
+
+        for (int i = 0; i < 64; i++)
+        {
+            if (runs[i])
+                sorted = mergeChains(runs[i], sorted, compare);
+        }
+
+        return sorted;
+    }
+
+    // Calls function(value) for every Node of a chunk,
+    // which ends where the next one starts (at nullptr for the last)
+    template <class Function>
+    void walkChunk(const vector<Node<V> *> &index, int chunk, Function function)
+    {
+        Node<V> *end = chunk + 1 < (int)index.size() ? index[chunk + 1] : nullptr;
+
+        for (Node<V> *current = index[chunk]; current != end; current = current->next)
+            function(current->value);
+    }
+
 public:
     // Constructor
     SingleLinkedList()
@@ -55,6 +335,46 @@ public:
         this->head = this->tail = nullptr;
     }
 
+    // Copy Constructor
+    // The copy gets Nodes of its own
+    SingleLinkedList(const SingleLinkedList &other) : SingleLinkedList()
+    {
+        for (Node<V> *current = other.head; current; current = current->next)
+            pushBack(current->value);
+    }
+
+    // Move Constructor
+    // Takes other's Nodes, leaving it empty
+    SingleLinkedList(SingleLinkedList &&other) noexcept(NOTHROW_MOVE) : SingleLinkedList()
+    {
+        takeNodes(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the List moved from), so take its Nodes
+    SingleLinkedList &operator=(SingleLinkedList other) noexcept(NOTHROW_MOVE)
+    {
+        clear();
+        takeNodes(other);
+
+        return *this;
+    }
+
+    // Destructor
+    ~SingleLinkedList()
+    {
+        clear();
+    }
+
+    // Trades Nodes with another List
+    void swap(SingleLinkedList &other) noexcept(NOTHROW_MOVE)
+    {
+        SingleLinkedList temporary(std::move(other));
+
+        other.takeNodes(*this);
+        takeNodes(temporary);
+    }
+
     // Method to add a Node in the List at the Back
     void pushBack(V value)
     {
@@ -62,7 +382,7 @@ public:
         Node<V> *newNode;
 
         // Create a new Node
-        if (nullptr == (newNode = new Node<V>(value)))
+        if (nullptr == (newNode = createNode(value)))
         {
             // Allocation failed
             return;
@@ -101,7 +421,7 @@ public:
                 if (head == current && tail == current)
                 {
                     // Delete the head
-                    delete head;
+                    destroyNode(head);
 
                     // Set head and tail to nullptr
                     head = tail = nullptr;
@@ -115,7 +435,7 @@ public:
                     head = head->next;
 
                     // Delete the current Node
-                    delete current;
+                    destroyNode(current);
                     return true;
                 }
 
@@ -129,7 +449,7 @@ public:
                     tail->next = nullptr;
 
                     // Delete the current Node
-                    delete current;
+                    destroyNode(current);
                     return true;
                 }
 
@@ -138,7 +458,7 @@ public:
                 previous->next = current->next;
 
                 // Delete the current Node
-                delete current;
+                destroyNode(current);
                 return true;
             }
 
@@ -150,6 +470,139 @@ public:
         return false;
     }
 
+    // Sorts the List by relinking its Nodes, without allocating
+    template <class Compare = less<V>>
+    void sort(Compare compare = Compare())
+    {
+        // Nothing to sort
+        if (head == tail)
+            return;
+
+        head = sortChain(head, compare);
+
+        // Find the new tail
+        for (tail = head; tail->next; tail = tail->next)
+            ;
+    }
+
+    // Writes the List to a stream in binary chunks
+    bool serialize(ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, LIST_MAGIC, checksummed);
+
+        // Trivially copyable values are laid out in a batch,
+        // which is added to the stream a chunk at a time
+        constexpr bool BULK = is_trivially_copyable<V>::value;
+        string batch;
+
+        // Write the values from the Head upto the Tail
+        for (Node<V> *current = head; current; current = current->next)
+        {
+            if constexpr (BULK)
+            {
+                batch.append((const char *)&current->value, sizeof(V));
+
+                if (batch.size() >= SERIALIZE_CHUNK_SIZE)
+                {
+                    writer.writeRecords(batch.data(), batch.size() / sizeof(V), sizeof(V));
+                    batch.clear();
+                }
+            }
+            else
+            {
+                writer.write(current->value);
+                writer.endRecord();
+            }
+        }
+
+        writer.writeRecords(batch.data(), batch.size() / sizeof(V), sizeof(V));
+
+        return writer.finish();
+    }
+
+    // Reads values written by serialize()
+    // and adds them at the Back of the List
+    bool deserialize(istream &in)
+    {
+        ChunkReader reader(in, LIST_MAGIC);
+        V value;
+
+        while (reader.nextRecord() && reader.read(value))
+            pushBack(value);
+
+        return reader.succeeded();
+    }
+
+    // Marks the first Node of every chunk of the List,
+    // so that each thread starts at its chunk instead of walking to it
+    using ChunkIndex = vector<Node<V> *>;
+
+    // Builds a ChunkIndex in one walk of the List
+    // It holds until a Node is added or removed, so a List that
+    // doesn't change can be split once for many parallel loops
+    ChunkIndex chunkIndex(int nodesPerChunk = PARALLEL_CHUNK_NODES)
+    {
+        ChunkIndex index;
+        int i = 0;
+
+        for (Node<V> *current = head; current != nullptr; current = current->next, i++)
+        {
+            if (i % nodesPerChunk == 0)
+                index.push_back(current);
+        }
+
+        return index;
+    }
+
+    // Calls function(value) for every Node, from the Head to the Tail
+    template <class Function>
+    void forEach(Function function)
+    {
+        for (Node<V> *current = head; current != nullptr; current = current->next)
+            function(current->value);
+    }
+
+    // Calls function(value) for every Node, on several threads
+    // Without an index, one is built first
+    // function may change the value, but no thread may change the List
+    template <class Function>
+    void forEachParallel(Function function, const ChunkIndex &index = ChunkIndex())
+    {
+        if (index.empty() && head != nullptr)
+            return forEachParallel(function, chunkIndex());
+
+        parallelFor(index.size(), [&](int chunk)
+                    { walkChunk(index, chunk, function); });
+    }
+
+    // Returns identity combine()d with map(value) of every Node,
+    // computed on several threads
+    // combine() must be associative and identity must leave a value
+    // unchanged, since each chunk starts from identity
+    template <class T, class Map, class Combine>
+    T reduceParallel(T identity, Map map, Combine combine, const ChunkIndex &index = ChunkIndex())
+    {
+        if (index.empty() && head != nullptr)
+            return reduceParallel(identity, map, combine, chunkIndex());
+
+        return parallelReduce(index.size(), identity, [&](int chunk)
+                              {
+            T result = identity;
+
+            walkChunk(index, chunk, [&](const V &value)
+                      { result = combine(result, map(value)); });
+
+            return result; }, combine);
+    }
+
+    // Returns the number of Nodes for which predicate(value) holds
+    template <class Predicate>
+    long countIf(Predicate predicate, const ChunkIndex &index = ChunkIndex())
+    {
+        return reduceParallel(0L, [&](const V &value)
+                              { return predicate(value) ? 1L : 0L; }, plus<long>(), index);
+    }
+
     // Method to print a List in the forward direction
     void printForward()
     {
@@ -178,12 +631,12 @@ public:
                 head = head->next;
 
                 // Delete current
-                delete current;
+                destroyNode(current);
 
                 counter++;
             }
 
-            delete head;
+            destroyNode(head);
             counter++;
             head = tail = nullptr;
         }
@@ -192,6 +645,101 @@ public:
     }
 };
 
+// Sums and counts values of a List of n Nodes serially,
+// then in parallel over one ChunkIndex
+void aggregateInParallel(int n)
+{
+    SingleLinkedList<int> large;
+
+    for (int i = 0; i < n; i++)
+        large.pushBack(i % 1000);
+
+    long serialSum = 0, serialEven = 0;
+    auto start = chrono::steady_clock::now();
+
+    large.forEach([&](int &value)
+                  { serialSum += value; serialEven += value % 2 == 0; });
+
+    auto serial = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    auto index = large.chunkIndex();
+
+    auto indexing = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    long sum = large.reduceParallel(0L, [](const int &value)
+                                    { return (long)value; }, plus<long>(), index);
+    long even = large.countIf([](const int &value)
+                              { return value % 2 == 0; }, index);
+
+    auto parallel = chrono::steady_clock::now() - start;
+
+    cout << "Serial : " << chrono::duration_cast<chrono::microseconds>(serial).count() << " us, "
+         << "chunkIndex() : " << chrono::duration_cast<chrono::microseconds>(indexing).count() << " us, "
+         << "parallel on " << parallelThreads() << " threads : "
+         << chrono::duration_cast<chrono::microseconds>(parallel).count() << " us ("
+         << (sum == serialSum && even == serialEven) << ")" << endl;
+
+    large.forEachParallel([](int &value)
+                          { value++; }, index);
+    cout << large.countIf([](const int &value)
+                          { return value == 1000; }, index)
+         << endl;
+
+    large.clear();
+}
+
+// Times sort() on a List of n scattered values against copying
+// them to a vector, std::sort and writing them back in order
+void sortAgainstVector(int n)
+{
+    SingleLinkedList<int> relinked;
+    SingleLinkedList<int> copied;
+
+    for (int i = 0; i < n; i++)
+    {
+        int value = (unsigned)i * 2654435761u % n;
+
+        relinked.pushBack(value);
+        copied.pushBack(value);
+    }
+
+    auto start = chrono::steady_clock::now();
+
+    relinked.sort();
+
+    auto sorting = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    vector<int> values;
+    values.reserve(n);
+
+    copied.forEach([&](int &value)
+                   { values.push_back(value); });
+
+    std::sort(values.begin(), values.end());
+
+    size_t next = 0;
+    copied.forEach([&](int &value)
+                   { value = values[next++]; });
+
+    auto copying = chrono::steady_clock::now() - start;
+
+    // Both Lists must now hold the same values in the same order
+    next = 0;
+    bool same = true;
+    relinked.forEach([&](int &value)
+                     { same = same && value == values[next++]; });
+
+    cout << "sort() : " << chrono::duration_cast<chrono::microseconds>(sorting).count() << " us, "
+         << "vector and std::sort : " << chrono::duration_cast<chrono::microseconds>(copying).count() << " us ("
+         << same << ")" << endl;
+
+    relinked.clear();
+    copied.clear();
+}
+
 int main()
 {
     // Create a new Single Linked List
@@ -203,6 +751,15 @@ int main()
 
     list.printForward();
 
+    // Round trip the List through a binary stream
+    stringstream stream;
+    list.serialize(stream, true);
+
+    SingleLinkedList<string> copy;
+    copy.deserialize(stream);
+    copy.printForward();
+    copy.clear();
+
     //cout << list.clear() << endl;
     //list.printForward();
 
@@ -217,5 +774,38 @@ int main()
 
     cout << list.clear() << endl;
 
+    // A List whose first 4 Nodes live inside the List object
+    SingleLinkedList<int, 4> small;
+
+    for (int i = 1; i <= 6; i++)
+        small.pushBack(i);
+
+    small.remove(2);
+    small.pushBack(7);
+    small.printForward();
+
+    // Sort it largest value first
+    small.sort(greater<int>());
+    small.printForward();
+
+    // Lists can be returned and stored by value
+    vector<SingleLinkedList<int, 4>> lists(2);
+
+    for (int i = 1; i <= 6; i++)
+        lists[0].pushBack(i);
+
+    lists.push_back(lists[0]);
+    lists[0].swap(lists[1]);
+    lists[1].printForward();
+    lists[2].printForward();
+
+    cout << small.clear() << endl;
+
+    // Aggregate a big List serially and on every core
+    aggregateInParallel(2000000);
+
+    // Sort a big List in place and through a vector
+    sortAgainstVector(1000000);
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,329 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         PersistentLinkedList.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Persistent (immutable) Single Linked List in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <forward_list>
+#include <chrono>
+
+using namespace std;
+
+// Node represents a value in the List
+// A Node never changes once it is made, so any number of
+// Lists (on any number of threads) may share it
+template <class V>
+struct Node
+{
+    // Holds the value of the Node
+    V value;
+
+    // Points to the next Node
+    Node<V> *next;
+
+    // Holds the number of Lists and Nodes pointing to the Node
+    atomic<int> references;
+
+    // Constructor
+    // The new Node takes over a reference to next
+    Node(V v, Node<V> *next) : value(std::move(v))
+    {
+        this->next = next;
+        this->references.store(1, memory_order_relaxed);
+    }
+};
+
+// Represents a Persistent Single Linked List
+//
+// A List is never changed : pushFront(), popFront() and remove()
+// return a new List that shares every Node it can with the old one.
+// pushFront() makes one Node and shares the whole old List as its
+// tail, so keeping every version costs a Node per update. Copying
+// a List (taking a snapshot for readers) copies one pointer.
+template <class V>
+class PersistentLinkedList
+{
+    // Points to the Head of the List
+    Node<V> *head;
+
+    // Holds the number of Nodes
+    int count;
+
+    // Constructor
+    // The List takes over a reference to head
+    PersistentLinkedList(Node<V> *head, int count)
+    {
+        this->head = head;
+        this->count = count;
+    }
+
+    // Adds a reference to a Node
+    static Node<V> *retain(Node<V> *node)
+    {
+        if (node)
+            node->references.fetch_add(1, memory_order_relaxed);
+
+        return node;
+    }
+
+    // Drops a reference to a Node, freeing it if it was the last one
+    // Freeing a Node drops its reference to the next Node, so this
+    // walks down the List until it reaches a Node still shared
+    static void release(Node<V> *node)
+    {
+        while (node && node->references.fetch_sub(1, memory_order_acq_rel) == 1)
+        {
+            Node<V> *next = node->next;
+
+            delete node;
+            node = next;
+        }
+    }
+
+public:
+    // Constructor
+    PersistentLinkedList()
+    {
+        head = nullptr;
+        count = 0;
+    }
+
+    // Copy Constructor
+    // The copy shares every Node, so it is O(1)
+    PersistentLinkedList(const PersistentLinkedList &other)
+    {
+        head = retain(other.head);
+        count = other.count;
+    }
+
+    // Move Constructor
+    PersistentLinkedList(PersistentLinkedList &&other) noexcept
+    {
+        head = other.head;
+        count = other.count;
+
+        other.head = nullptr;
+        other.count = 0;
+    }
+
+    // Copy and Move Assignment
+    PersistentLinkedList &operator=(PersistentLinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    // Frees the Nodes no other List shares
+    ~PersistentLinkedList()
+    {
+        release(head);
+    }
+
+    // Trades Nodes with another List
+    void swap(PersistentLinkedList &other) noexcept
+    {
+        std::swap(head, other.head);
+        std::swap(count, other.count);
+    }
+
+    // Returns a List with value at the Front, and this List after it
+    PersistentLinkedList pushFront(V value) const
+    {
+        return PersistentLinkedList(new Node<V>(std::move(value), retain(head)), count + 1);
+    }
+
+    // Returns the List after the Front
+    // (an empty List if this one is empty)
+    PersistentLinkedList popFront() const
+    {
+        if (!head)
+            return PersistentLinkedList();
+
+        return PersistentLinkedList(retain(head->next), count - 1);
+    }
+
+    // Gives back the value at the Front
+    bool front(V &value) const
+    {
+        // The List is empty
+        if (!head)
+            return false;
+
+        value = head->value;
+        return true;
+    }
+
+    // Returns true if the List holds value
+    bool contains(const V &value) const
+    {
+        for (Node<V> *current = head; current; current = current->next)
+        {
+            if (current->value == value)
+                return true;
+        }
+
+        return false;
+    }
+
+    // Returns a List without the first Node holding value
+    // The Nodes before it are copied, the ones after it are shared
+    PersistentLinkedList remove(const V &value) const
+    {
+        // Search for the value in the List
+        int position = 0;
+        Node<V> *found = head;
+
+        for (; found && !(found->value == value); found = found->next)
+            position++;
+
+        // Value not found, so the List is the same
+        if (!found)
+            return *this;
+
+        // Copy the Nodes before the value, back to front,
+        // on top of the Nodes after it
+        vector<Node<V> *> before;
+
+        for (Node<V> *current = head; current != found; current = current->next)
+            before.push_back(current);
+
+        Node<V> *rest = retain(found->next);
+
+        for (int i = position - 1; i >= 0; i--)
+            rest = new Node<V>(before[i]->value, rest);
+
+        return PersistentLinkedList(rest, count - 1);
+    }
+
+    // Returns the number of Nodes
+    int size() const
+    {
+        return count;
+    }
+
+    // Method to print a List in the forward direction
+    void printForward() const
+    {
+        for (Node<V> *current = head; current; current = current->next)
+            cout << current->value << " ";
+
+        cout << endl;
+    }
+};
+
+// Keeps a snapshot of a List of n values after every one of
+// updates pushFront()s, against deep copying a mutable List
+void snapshotsAgainstCopies(int n, int updates)
+{
+    PersistentLinkedList<int> list;
+    forward_list<int> mutableList;
+
+    for (int i = 0; i < n; i++)
+    {
+        list = list.pushFront(i);
+        mutableList.push_front(i);
+    }
+
+    vector<PersistentLinkedList<int>> snapshots;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < updates; i++)
+    {
+        list = list.pushFront(i);
+        snapshots.push_back(list);
+    }
+
+    auto sharing = chrono::steady_clock::now() - start;
+
+    vector<forward_list<int>> copies;
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < updates; i++)
+    {
+        mutableList.push_front(i);
+        copies.push_back(mutableList);
+    }
+
+    auto copying = chrono::steady_clock::now() - start;
+
+    // Every snapshot shares the same n Nodes, where each copy has its own
+    long sharedNodes = n + updates;
+    long copiedNodes = 0;
+
+    for (auto &copy : copies)
+    {
+        for (auto it = copy.begin(); it != copy.end(); ++it)
+            copiedNodes++;
+    }
+
+    cout << updates << " snapshots : " << chrono::duration_cast<chrono::microseconds>(sharing).count() << " us, "
+         << sharedNodes * sizeof(Node<int>) / 1024 << " KB, deep copies : "
+         << chrono::duration_cast<chrono::microseconds>(copying).count() << " us, "
+         << copiedNodes * (sizeof(int) + sizeof(void *)) / 1024 << " KB" << endl;
+}
+
+int main()
+{
+    // Create a new Persistent List
+    PersistentLinkedList<string> empty;
+
+    PersistentLinkedList<string> list = empty.pushFront("Stepanov").pushFront("Bjarne").pushFront("Dennis");
+    list.printForward();
+
+    // Every version stays as it was
+    PersistentLinkedList<string> withoutBjarne = list.remove("Bjarne");
+    PersistentLinkedList<string> tail = list.popFront();
+
+    list.printForward();
+    withoutBjarne.printForward();
+    tail.printForward();
+
+    cout << empty.size() << " " << list.size() << " " << withoutBjarne.size() << endl;
+
+    // A reader thread works from a snapshot while the List moves on
+    PersistentLinkedList<int> numbers;
+
+    for (int i = 1; i <= 100; i++)
+        numbers = numbers.pushFront(i);
+
+    PersistentLinkedList<int> snapshot = numbers;
+
+    thread reader([snapshot]
+                  {
+        long sum = 0;
+        PersistentLinkedList<int> rest = snapshot;
+        int value;
+
+        while (rest.front(value))
+        {
+            sum += value;
+            rest = rest.popFront();
+        }
+
+        cout << sum << endl; });
+
+    for (int i = 0; i < 100; i++)
+        numbers = numbers.popFront();
+
+    reader.join();
+    cout << numbers.size() << " " << snapshot.size() << endl;
+
+    snapshotsAgainstCopies(100000, 100);
+
+    return 0;
+}
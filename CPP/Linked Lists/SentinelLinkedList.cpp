@@ -9,14 +9,25 @@
  * --------------------------------------------------------------------------------
  *
  * Revision History :
+ * 2026-October-19	[AG] : Chunked streams come from ChunkStream.h
+ * 2026-October-19	[AG] : Added copy, move, swap(), clear() and a destructor
+ * 2026-October-19	[AG] : Added serialize() and deserialize()
  * 2020-August-01	[SP] : Created
  * --------------------------------------------------------------------------------
  */
 
 #include <iostream>
+#include <string>
+#include <sstream>
+#include <cstdint>
+
+#include "../Serialization/ChunkStream.h"
 
 using namespace std;
 
+// Marks the start of a serialized List ("LST1")
+const uint32_t LIST_MAGIC = 0x3154534C;
+
 // Node represents a value in the List
 struct Node
 {
@@ -40,6 +51,10 @@ struct Node
 // Represents the SentinelLinkedList
 class SentinelLinkedList
 {
+    // The Dummy Node lives inside the List object,
+    // so that no List is ever without one
+    Node dummy;
+
     // Points to the Dummy Head
     Node *head;
 
@@ -48,16 +63,62 @@ class SentinelLinkedList
 
 public:
     // Constructor
-    SentinelLinkedList()
+    SentinelLinkedList() : dummy(0)
     {
-        // Create dummy Nodes
-        head = tail = new Node(0);
+        // The Dummy Node is both the head and the tail
+        head = tail = &dummy;
 
         // Point head and tail to each other
         head->next = tail;
         (*tail).previous = head;
     }
 
+    // Copy Constructor
+    // The copy gets Nodes of its own
+    SentinelLinkedList(const SentinelLinkedList &other) : SentinelLinkedList()
+    {
+        for (Node *current = other.head->next; current != other.tail; current = current->next)
+            pushBack(current->value);
+    }
+
+    // Move Constructor
+    // Takes other's Nodes, leaving it empty
+    SentinelLinkedList(SentinelLinkedList &&other) noexcept : SentinelLinkedList()
+    {
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the List moved from),
+    // so its Nodes are taken and ours go away with it
+    SentinelLinkedList &operator=(SentinelLinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~SentinelLinkedList()
+    {
+        clear();
+    }
+
+    // Trades Nodes with another List
+    // Each List keeps its own Dummy Node, only the
+    // first and last real Nodes are relinked to the other one
+    void swap(SentinelLinkedList &other) noexcept
+    {
+        // nullptr stands for an empty chain
+        Node *first = head->next != tail ? head->next : nullptr;
+        Node *last = tail->previous;
+
+        Node *otherFirst = other.head->next != other.tail ? other.head->next : nullptr;
+        Node *otherLast = other.tail->previous;
+
+        relink(otherFirst, otherLast);
+        other.relink(first, last);
+    }
+
     // Method to add a Node in the Linked List
     void pushBack(int value)
     {
@@ -119,6 +180,34 @@ public:
         return false;
     }
 
+    // Writes the List to a stream in binary chunks
+    bool serialize(ostream &out, bool checksummed = false)
+    {
+        ChunkWriter writer(out, LIST_MAGIC, checksummed);
+
+        // Write the values from the Head upto the Tail
+        for (Node *current = head->next; current != tail; current = current->next)
+        {
+            writer.write(current->value);
+            writer.endRecord();
+        }
+
+        return writer.finish();
+    }
+
+    // Reads values written by serialize()
+    // and adds them at the Back of the List
+    bool deserialize(istream &in)
+    {
+        ChunkReader reader(in, LIST_MAGIC);
+        int value;
+
+        while (reader.nextRecord() && reader.read(value))
+            pushBack(value);
+
+        return reader.succeeded();
+    }
+
     // Method to print the List in Forward direction
     void printForward()
     {
@@ -131,6 +220,45 @@ public:
 
         cout << endl;
     }
+
+    // Clears the entire List
+    int clear()
+    {
+        int counter = 0;
+
+        // Delete every Node in between the Dummy Nodes
+        for (Node *current = head->next, *next; current != tail; current = next)
+        {
+            next = current->next;
+
+            delete current;
+            counter++;
+        }
+
+        head->next = tail;
+        tail->previous = head;
+
+        return counter;
+    }
+
+private:
+    // Makes a chain of Nodes from first upto last this List's Nodes
+    void relink(Node *first, Node *last)
+    {
+        // The chain is empty
+        if (!first)
+        {
+            head->next = tail;
+            tail->previous = head;
+            return;
+        }
+
+        first->previous = head;
+        last->next = tail;
+
+        head->next = first;
+        tail->previous = last;
+    }
 };
 
 int main()
@@ -147,5 +275,20 @@ int main()
         list.pushBack(value);
     }
 
+    // Round trip the List through a binary stream
+    stringstream stream;
+    list.serialize(stream, true);
+
+    SentinelLinkedList copy;
+    copy.deserialize(stream);
+    copy.printForward();
+
+    // Lists can be copied and moved around by value
+    SentinelLinkedList moved(std::move(copy));
+    copy = moved;
+
+    moved.printForward();
+    cout << copy.clear() << " " << list.clear() << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,543 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         SkipList.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Skip List (ordered map) in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Links are made in the storage after the Node, not past next[1]
+ * 2026-October-19	[AG] : Nodes hold their links inline, one allocation each
+ * 2026-October-19	[AG] : A moved from container is empty and usable
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <new>
+#include <map>
+#include <vector>
+#include <chrono>
+
+using namespace std;
+
+// Node represents a key-value pair in the Skip List
+//
+// The bottom level is a plain Single Linked List sorted by key :
+// next()[0] points to the next Node, just like Node::next does.
+// A Node that is "height" levels tall is also on the Lists
+// above it, where next()[i] skips ahead over the shorter Nodes
+//
+// The links are stored right after the Node, in the same
+// allocation, so a Node costs one allocation and stepping to the
+// next Node never takes a second cache miss to find its links.
+// Nodes are made with create() and freed with destroy()
+template <class K, class V>
+struct Node
+{
+    // Holds the key of the Node
+    K key;
+
+    // Holds the value of the Node
+    V value;
+
+    // Holds the number of levels the Node is on
+    int height;
+
+    // Returns where the links start, from the start of the storage
+    // (past the Node, rounded up so the links are aligned)
+    static size_t linksOffset()
+    {
+        return (sizeof(Node<K, V>) + alignof(Node<K, V> *) - 1) / alignof(Node<K, V> *) * alignof(Node<K, V> *);
+    }
+
+    // Returns the links to the next Node on each level
+    Node<K, V> **next()
+    {
+        return reinterpret_cast<Node<K, V> **>(reinterpret_cast<char *>(this) + linksOffset());
+    }
+
+    // Makes a Node "height" levels tall in a single allocation
+    static Node<K, V> *create(const K &k, const V &v, int h)
+    {
+        void *memory = ::operator new(linksOffset() + h * sizeof(Node<K, V> *));
+
+        // Initially the Node is not linked on any level
+        char *links = static_cast<char *>(memory) + linksOffset();
+        for (int i = 0; i < h; i++)
+            new (links + i * sizeof(Node<K, V> *)) Node<K, V> *(nullptr);
+
+        return new (memory) Node<K, V>(k, v, h);
+    }
+
+    // Frees a Node made by create()
+    static void destroy(Node<K, V> *node)
+    {
+        if (node)
+        {
+            node->~Node<K, V>();
+            ::operator delete(node);
+        }
+    }
+
+private:
+    // Constructor
+    // Only create() knows how much room to make for the links
+    Node(const K &k, const V &v, int h) : key(k), value(v)
+    {
+        this->height = h;
+    }
+};
+
+// Represents a Skip List
+//
+// Searching starts on the top level and drops down a level
+// each time the next key is too big, so that insert(), get(),
+// erase() and lowerBound() all take O(log n) on average
+template <class K, class V>
+class SkipList
+{
+    // Holds the most levels a Node can be on
+    static const int MAX_LEVEL = 32;
+
+    // Points to the Dummy Head, which is on every level
+    Node<K, V> *head;
+
+    // Holds the number of levels in use
+    int level;
+
+    // Holds the number of Nodes
+    int count;
+
+    // Holds the state of the random number generator
+    uint64_t randomState;
+
+    // Returns the height of a new Node
+    // Each level is reached by a quarter of the Nodes below it
+    int randomHeight()
+    {
+        // xorshift64
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+
+        uint64_t bits = randomState;
+        int height = 1;
+
+        while (height < MAX_LEVEL && !(bits & 3))
+        {
+            height++;
+            bits >>= 2;
+        }
+
+        return height;
+    }
+
+    // Finds the last Node before key on every level in use
+    // Returns the first Node on the bottom level that is not before key
+    Node<K, V> *findPredecessors(K key, Node<K, V> **predecessors)
+    {
+        Node<K, V> *current = head;
+
+        // Go right while the next key is smaller, then drop down a level
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->next()[i] && current->next()[i]->key < key)
+                current = current->next()[i];
+
+            predecessors[i] = current;
+        }
+
+        return current->next()[0];
+    }
+
+public:
+    // Points at a Node of the Skip List, or past the last one
+    class Iterator
+    {
+        // Points to the Node, nullptr past the last one
+        Node<K, V> *node;
+
+    public:
+        // Constructor
+        Iterator(Node<K, V> *node)
+        {
+            this->node = node;
+        }
+
+        const K &key()
+        {
+            return node->key;
+        }
+
+        V &value()
+        {
+            return node->value;
+        }
+
+        Iterator &operator++()
+        {
+            node = node->next()[0];
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return node != other.node;
+        }
+    };
+
+    // Constructor
+    SkipList()
+    {
+        // The Dummy Head holds the default key and value of a type
+        head = Node<K, V>::create(K(), V(), MAX_LEVEL);
+
+        level = 1;
+        count = 0;
+        randomState = 0x9E3779B97F4A7C15ull;
+    }
+
+    // Copy Constructor
+    // The copy gets Nodes of its own, each as tall as the one it copies
+    SkipList(const SkipList &other) : SkipList()
+    {
+        // Holds the last Node copied onto each level
+        Node<K, V> *last[MAX_LEVEL];
+
+        for (int i = 0; i < MAX_LEVEL; i++)
+            last[i] = head;
+
+        // The keys are already in order, so every Node
+        // goes at the end of each of its levels
+        for (Node<K, V> *current = other.head ? other.head->next()[0] : nullptr; current; current = current->next()[0])
+        {
+            Node<K, V> *newNode = Node<K, V>::create(current->key, current->value, current->height);
+
+            for (int i = 0; i < newNode->height; i++)
+            {
+                last[i]->next()[i] = newNode;
+                last[i] = newNode;
+            }
+        }
+
+        level = other.level;
+        count = other.count;
+        randomState = other.randomState;
+    }
+
+    // Move Constructor
+    // Takes other's Nodes and Dummy Head in O(1)
+    // other is left empty, and only gets a Dummy Head again on its next insert()
+    SkipList(SkipList &&other) noexcept
+    {
+        head = other.head;
+        level = other.level;
+        count = other.count;
+        randomState = other.randomState;
+
+        other.head = nullptr;
+        other.level = 1;
+        other.count = 0;
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the Skip List moved from),
+    // so its Nodes are taken and ours go away with it
+    SkipList &operator=(SkipList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~SkipList()
+    {
+        clear();
+        Node<K, V>::destroy(head);
+    }
+
+    // Trades Nodes with another Skip List
+    void swap(SkipList &other) noexcept
+    {
+        std::swap(head, other.head);
+        std::swap(level, other.level);
+        std::swap(count, other.count);
+        std::swap(randomState, other.randomState);
+    }
+
+    // Adds a key-value pair to the Skip List
+    // Returns false if the key was already there, and replaces its value
+    bool insert(K key, V value)
+    {
+        // A moved from Skip List needs a Dummy Head again
+        if (!head)
+            head = Node<K, V>::create(K(), V(), MAX_LEVEL);
+
+        Node<K, V> *predecessors[MAX_LEVEL];
+        Node<K, V> *current = findPredecessors(key, predecessors);
+
+        // Key found, replace its value
+        if (current && !(key < current->key))
+        {
+            current->value = value;
+            return false;
+        }
+
+        // Holds the new Node
+        Node<K, V> *newNode = Node<K, V>::create(key, value, randomHeight());
+
+        // The new Node is taller than every other Node
+        // The head is its predecessor on the new levels
+        for (; level < newNode->height; level++)
+            predecessors[level] = head;
+
+        // Link the new Node in after its predecessor on each of its levels
+        for (int i = 0; i < newNode->height; i++)
+        {
+            newNode->next()[i] = predecessors[i]->next()[i];
+            predecessors[i]->next()[i] = newNode;
+        }
+
+        count++;
+        return true;
+    }
+
+    // Gets the value of a key from the Skip List
+    bool get(K key, V &value)
+    {
+        Iterator found = find(key);
+
+        // No such key in the Skip List
+        if (found == end())
+            return false;
+
+        value = found.value();
+        return true;
+    }
+
+    // Returns an Iterator to the Node with key, or end() if there is none
+    Iterator find(K key)
+    {
+        Iterator found = lowerBound(key);
+
+        if (found != end() && key < found.key())
+            return end();
+
+        return found;
+    }
+
+    // Returns an Iterator to the first Node whose key is not before key
+    Iterator lowerBound(K key)
+    {
+        // A moved from Skip List has no Dummy Head
+        if (!head)
+            return end();
+
+        Node<K, V> *current = head;
+
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->next()[i] && current->next()[i]->key < key)
+                current = current->next()[i];
+        }
+
+        return Iterator(current->next()[0]);
+    }
+
+    // Returns an Iterator to the first Node
+    Iterator begin()
+    {
+        return Iterator(head ? head->next()[0] : nullptr);
+    }
+
+    // Returns an Iterator past the last Node
+    Iterator end()
+    {
+        return Iterator(nullptr);
+    }
+
+    // Removes a key-value pair from the Skip List
+    bool erase(K key)
+    {
+        // A moved from Skip List has no Dummy Head
+        if (!head)
+            return false;
+
+        Node<K, V> *predecessors[MAX_LEVEL];
+        Node<K, V> *current = findPredecessors(key, predecessors);
+
+        // No such key in the Skip List
+        if (!current || key < current->key)
+            return false;
+
+        // Unlink the Node on each of its levels
+        for (int i = 0; i < current->height; i++)
+            predecessors[i]->next()[i] = current->next()[i];
+
+        // Drop the levels that are now empty
+        while (level > 1 && !head->next()[level - 1])
+            level--;
+
+        Node<K, V>::destroy(current);
+        count--;
+
+        return true;
+    }
+
+    // Returns the number of key-value pairs
+    int size()
+    {
+        return count;
+    }
+
+    // Prints the Skip List in key order
+    void printForward()
+    {
+        for (Node<K, V> *current = head ? head->next()[0] : nullptr; current; current = current->next()[0])
+        {
+            cout << "[" << current->key << " : " << current->value << "]";
+
+            if (current->next()[0])
+                cout << " -> ";
+        }
+
+        cout << endl;
+    }
+
+    // Clears the entire Skip List
+    int clear()
+    {
+        int counter = 0;
+
+        // A moved from Skip List has nothing to clear
+        if (!head)
+            return counter;
+
+        // Every Node is on the bottom level
+        // so deleting along it deletes them all
+        for (Node<K, V> *current = head->next()[0], *next; current; current = next)
+        {
+            next = current->next()[0];
+
+            Node<K, V>::destroy(current);
+            counter++;
+        }
+
+        for (int i = 0; i < MAX_LEVEL; i++)
+            head->next()[i] = nullptr;
+
+        level = 1;
+        count = 0;
+
+        return counter;
+    }
+};
+
+// Inserts n random keys, then looks each one up,
+// in a Skip List and in a std::map
+void againstMap(int n)
+{
+    vector<int> keys(n);
+    uint64_t state = 88172645463325252ull;
+
+    for (int &key : keys)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        key = (int)(state >> 33);
+    }
+
+    SkipList<int, int> list;
+    map<int, int> tree;
+
+    auto start = chrono::steady_clock::now();
+
+    for (int key : keys)
+        list.insert(key, key);
+
+    auto listInserts = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (int key : keys)
+        tree[key] = key;
+
+    auto mapInserts = chrono::steady_clock::now() - start;
+
+    long found = 0;
+    int value;
+
+    start = chrono::steady_clock::now();
+
+    for (int key : keys)
+        found += list.get(key, value);
+
+    auto listLookups = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (int key : keys)
+        found += tree.find(key) != tree.end();
+
+    auto mapLookups = chrono::steady_clock::now() - start;
+
+    cout << "Skip List inserts : " << chrono::duration_cast<chrono::milliseconds>(listInserts).count() << " ms, "
+         << "lookups : " << chrono::duration_cast<chrono::milliseconds>(listLookups).count() << " ms; "
+         << "std::map inserts : " << chrono::duration_cast<chrono::milliseconds>(mapInserts).count() << " ms, "
+         << "lookups : " << chrono::duration_cast<chrono::milliseconds>(mapLookups).count() << " ms ("
+         << (found == 2L * n) << ")" << endl;
+}
+
+int main()
+{
+    // Create a new Skip List
+    SkipList<int, string> list;
+
+    list.insert(30, "Stepanov");
+    list.insert(10, "Dennis");
+    list.insert(50, "Knuth");
+    list.insert(20, "Bjarne");
+    list.insert(40, "Dijkstra");
+
+    list.printForward();
+
+    string result;
+    if (list.get(20, result))
+        cout << result << endl;
+
+    // Print every key from 15 upto (not including) 45
+    for (auto current = list.lowerBound(15); current != list.end() && current.key() < 45; ++current)
+        cout << current.key() << " ";
+    cout << endl;
+
+    list.erase(30);
+    list.printForward();
+
+    // Skip Lists can be copied and moved around by value
+    SkipList<int, string> copy(list);
+    SkipList<int, string> moved(std::move(list));
+
+    copy.insert(25, "Hopper");
+    copy.printForward();
+    moved.printForward();
+
+    list = copy;
+    cout << copy.clear() << " " << moved.clear() << endl;
+
+    // Compare against the balanced tree behind std::map
+    againstMap(1000000);
+
+    return 0;
+}
@@ -0,0 +1,456 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         XorLinkedList.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : XOR Linked (Double Linked) List in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : main times a walk and sizes the Nodes against two pointers per Node
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <chrono>
+
+using namespace std;
+
+// Node represents a value in the List
+//
+// Instead of a previous and a next pointer, a Node holds
+// the two XORed together in one word. Walking the List in
+// either direction, the Node we came from is known, and
+// XORing it out of link leaves the Node we are going to
+template <class V>
+struct Node
+{
+    // Holds the value of the Node
+    V value;
+
+    // Holds previous ^ next (a missing neighbour counts as 0)
+    uintptr_t link;
+
+    // Constructor
+    Node(V v)
+    {
+        this->value = v;
+        this->link = 0;
+    }
+};
+
+// Returns the neighbour of a Node on the other side from one neighbour
+template <class V>
+Node<V> *step(Node<V> *node, Node<V> *from)
+{
+    return (Node<V> *)(node->link ^ (uintptr_t)from);
+}
+
+// Represents an XOR Linked List
+// It can be walked and changed at both ends, like a Double Linked List,
+// with one word of links per Node instead of two
+template <class V>
+class XorLinkedList
+{
+    // Points to the Head
+    Node<V> *head;
+
+    // Points to the Tail
+    Node<V> *tail;
+
+    // Holds the number of Nodes
+    int count;
+
+    // Links a new Node in between two neighbouring Nodes
+    // (either may be nullptr at the ends of the List)
+    void linkBetween(Node<V> *before, Node<V> *newNode, Node<V> *after)
+    {
+        newNode->link = (uintptr_t)before ^ (uintptr_t)after;
+
+        // Swap after for newNode in before's link, and before for newNode in after's
+        if (before)
+            before->link ^= (uintptr_t)after ^ (uintptr_t)newNode;
+        else
+            head = newNode;
+
+        if (after)
+            after->link ^= (uintptr_t)before ^ (uintptr_t)newNode;
+        else
+            tail = newNode;
+
+        count++;
+    }
+
+    // Unlinks and deletes a Node, given its previous Node
+    void unlink(Node<V> *before, Node<V> *current)
+    {
+        Node<V> *after = step(current, before);
+
+        // Swap current for after in before's link, and current for before in after's
+        if (before)
+            before->link ^= (uintptr_t)current ^ (uintptr_t)after;
+        else
+            head = after;
+
+        if (after)
+            after->link ^= (uintptr_t)current ^ (uintptr_t)before;
+        else
+            tail = before;
+
+        delete current;
+        count--;
+    }
+
+public:
+    // Points at a Node of the List, or past the Tail
+    //
+    // A Node alone can't say where its neighbours are,
+    // so the Iterator also carries the Node before it
+    class Iterator
+    {
+        // Points to the Node before node, nullptr before the Head
+        Node<V> *previous;
+
+        // Points to the Node, nullptr past the Tail
+        Node<V> *node;
+
+    public:
+        // Constructor
+        Iterator(Node<V> *previous, Node<V> *node)
+        {
+            this->previous = previous;
+            this->node = node;
+        }
+
+        V &operator*()
+        {
+            return node->value;
+        }
+
+        V *operator->()
+        {
+            return &node->value;
+        }
+
+        Iterator &operator++()
+        {
+            Node<V> *next = step(node, previous);
+
+            previous = node;
+            node = next;
+
+            return *this;
+        }
+
+        // From end() this steps back onto the Tail
+        Iterator &operator--()
+        {
+            Node<V> *before = previous;
+
+            previous = before ? step(before, node) : nullptr;
+            node = before;
+
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return node != other.node;
+        }
+    };
+
+    // Default Constructor
+    XorLinkedList()
+    {
+        // Head and Tail are initially nullptr
+        // as the List is empty
+        head = tail = nullptr;
+        count = 0;
+    }
+
+    // Copy Constructor
+    // The copy gets Nodes of its own
+    XorLinkedList(const XorLinkedList &other) : XorLinkedList()
+    {
+        for (Node<V> *previous = nullptr, *current = other.head, *next; current; previous = current, current = next)
+        {
+            next = step(current, previous);
+            pushBack(current->value);
+        }
+    }
+
+    // Move Constructor
+    // Takes other's Nodes, leaving it empty
+    XorLinkedList(XorLinkedList &&other) noexcept : XorLinkedList()
+    {
+        swap(other);
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the List moved from),
+    // so its Nodes are taken and ours go away with it
+    XorLinkedList &operator=(XorLinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~XorLinkedList()
+    {
+        clear();
+    }
+
+    // Trades Nodes with another List
+    // No link holds the address of the List itself,
+    // so the Head and Tail pointers are all there is to swap
+    void swap(XorLinkedList &other) noexcept
+    {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+    }
+
+    // Method to add a Node at the Back of the List
+    void pushBack(V value)
+    {
+        linkBetween(tail, new Node<V>(value), nullptr);
+    }
+
+    // Method to add a Node at the Front of the List
+    void pushFront(V value)
+    {
+        linkBetween(nullptr, new Node<V>(value), head);
+    }
+
+    // Method to remove the Node at the Front of the List
+    bool popFront(V &value)
+    {
+        // The List is empty
+        if (!head)
+            return false;
+
+        value = head->value;
+        unlink(nullptr, head);
+
+        return true;
+    }
+
+    // Method to remove the Node at the Back of the List
+    bool popBack(V &value)
+    {
+        // The List is empty
+        if (!tail)
+            return false;
+
+        value = tail->value;
+
+        // The Tail's link is just its previous Node
+        unlink(step(tail, (Node<V> *)nullptr), tail);
+
+        return true;
+    }
+
+    // Method to remove a Node from the List
+    bool remove(V value)
+    {
+        // Search for the value, keeping the Node before current
+        for (Node<V> *previous = nullptr, *current = head, *next; current; previous = current, current = next)
+        {
+            next = step(current, previous);
+
+            // Value found!
+            if (current->value == value)
+            {
+                unlink(previous, current);
+                return true;
+            }
+        }
+
+        // Value not in the List
+        return false;
+    }
+
+    // Reverses the List
+    // The links read the same in both directions,
+    // so only the Head and Tail trade places
+    void reverse()
+    {
+        std::swap(head, tail);
+    }
+
+    // Returns an Iterator to the Head
+    Iterator begin()
+    {
+        return Iterator(nullptr, head);
+    }
+
+    // Returns an Iterator past the Tail
+    Iterator end()
+    {
+        return Iterator(tail, nullptr);
+    }
+
+    // Returns the number of Nodes
+    int size()
+    {
+        return count;
+    }
+
+    // Method to print the List in Forward Direction
+    void printForward()
+    {
+        // Start from the head and go upto tail
+        for (Node<V> *previous = nullptr, *current = head, *next; current; previous = current, current = next)
+        {
+            next = step(current, previous);
+
+            // Print the current Node's value
+            cout << current->value << " ";
+
+            if (next)
+                cout << " <=> ";
+        }
+        cout << endl;
+    }
+
+    // Method to print the List in Backward Direction
+    void printBackward()
+    {
+        // Start from the tail and go upto head
+        for (Node<V> *next = nullptr, *current = tail, *previous; current; next = current, current = previous)
+        {
+            previous = step(current, next);
+
+            // Print the current Node's value
+            cout << current->value << " ";
+
+            if (previous)
+                cout << " <=> ";
+        }
+        cout << endl;
+    }
+
+    // Method to clear the entire List
+    int clear()
+    {
+        int counter = 0;
+
+        // Start from the head and keep on deleting Nodes
+        for (Node<V> *previous = nullptr, *current = head, *next; current; current = next)
+        {
+            next = step(current, previous);
+
+            // Only the address of previous is needed
+            // to step on, so it can be deleted already
+            previous = current;
+            delete current;
+            counter++;
+        }
+
+        head = tail = nullptr;
+        count = 0;
+
+        return counter;
+    }
+};
+
+// A Node of an ordinary Double Linked List, to compare against
+template <class V>
+struct TwoPointerNode
+{
+    V value;
+    TwoPointerNode<V> *previous;
+    TwoPointerNode<V> *next;
+};
+
+// Times walking an XOR Linked List of n values, against a
+// Double Linked List with a previous and a next pointer per Node,
+// and prints the memory held by the Nodes of each
+void xorAgainstTwoPointers(int n)
+{
+    XorLinkedList<int> list;
+    TwoPointerNode<int> *head = nullptr, *tail = nullptr;
+
+    for (int i = 0; i < n; i++)
+    {
+        list.pushBack(i);
+
+        TwoPointerNode<int> *node = new TwoPointerNode<int>{i, tail, nullptr};
+        (tail ? tail->next : head) = node;
+        tail = node;
+    }
+
+    long xorSum = 0, twoPointerSum = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (auto value : list)
+        xorSum += value;
+
+    auto xorWalk = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (auto current = head; current; current = current->next)
+        twoPointerSum += current->value;
+
+    auto twoPointerWalk = chrono::steady_clock::now() - start;
+
+    cout << n << " Nodes, XOR : " << chrono::duration_cast<chrono::microseconds>(xorWalk).count() << " us, "
+         << n * sizeof(Node<int>) / 1024 << " KB, two pointers : "
+         << chrono::duration_cast<chrono::microseconds>(twoPointerWalk).count() << " us, "
+         << n * sizeof(TwoPointerNode<int>) / 1024 << " KB (" << (xorSum == twoPointerSum) << ")" << endl;
+
+    while (head)
+    {
+        TwoPointerNode<int> *next = head->next;
+        delete head;
+        head = next;
+    }
+
+    list.clear();
+}
+
+int main()
+{
+    // Create a new XOR Linked List
+    XorLinkedList<int> list;
+
+    for (int i = 1; i <= 5; i++)
+        list.pushBack(i * 10);
+
+    list.pushFront(0);
+    list.printForward();
+    list.printBackward();
+
+    // Walk forward, then step back from the end
+    auto current = list.end();
+    --current;
+    --current;
+    cout << *current << endl;
+
+    list.remove(30);
+    list.reverse();
+    list.printForward();
+
+    int value;
+    if (list.popFront(value) && list.popBack(value))
+        cout << value << " " << list.size() << endl;
+
+    cout << list.clear() << endl;
+
+    // One word of links per Node instead of two
+    xorAgainstTwoPointers(1000000);
+
+    return 0;
+}
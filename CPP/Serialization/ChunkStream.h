@@ -0,0 +1,377 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         ChunkStream.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Chunked binary streams for serialize() and deserialize() in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Added writeRecords() for batches of fixed size records
+ * 2026-October-19	[AG] : Created from the copies in the containers,
+ *                         bounds chunk lengths and rejects trailing bytes
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef CHUNK_STREAM_H
+#define CHUNK_STREAM_H
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * A serialized container is a stream header followed by chunks :
+ *    [magic : uint32] [flags : uint32]
+ *    [count : uint32] [length : uint32] [payload] [checksum : uint32]?
+ *    ...
+ *    [0 : uint32] [0 : uint32]
+ *
+ * Each chunk holds "count" records in "length" bytes and is
+ * never much bigger than SERIALIZE_CHUNK_SIZE, so neither side
+ * has to hold a second copy of the whole container.
+ *
+ * Every container writes its records the same way :
+ *
+ *    ChunkWriter writer(out, LIST_MAGIC, checksummed);
+ *    writer.write(value);
+ *    writer.endRecord();
+ *    ...
+ *    return writer.finish();
+ *
+ *    ChunkReader reader(in, LIST_MAGIC);
+ *    while (reader.nextRecord() && reader.read(value))
+ *        ...
+ *    return reader.succeeded();
+ */
+
+// Set in the stream header when every chunk carries a checksum
+const uint32_t SERIALIZE_CHECKSUM = 1;
+
+// Chunks are flushed once their payload reaches this many bytes
+const size_t SERIALIZE_CHUNK_SIZE = 64 * 1024;
+
+// Holds the most bytes a single record may take
+// A chunk is flushed after the record that fills it, so its payload
+// is never longer than SERIALIZE_CHUNK_SIZE plus one record
+const size_t SERIALIZE_RECORD_SIZE = 16 * 1024 * 1024;
+
+// Returns the FNV-1a checksum of a chunk's payload
+inline uint32_t chunkChecksum(const char *data, size_t length)
+{
+    uint32_t checksum = 2166136261u;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        checksum ^= (unsigned char)data[i];
+        checksum *= 16777619u;
+    }
+
+    return checksum;
+}
+
+// Appends a value to a chunk's payload
+template <class T>
+void writeValue(std::string &payload, const T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Values must be trivially copyable or strings");
+
+    payload.append((const char *)&value, sizeof(value));
+}
+
+// Appends a string to a chunk's payload, length first
+inline void writeValue(std::string &payload, const std::string &value)
+{
+    uint32_t length = value.size();
+
+    payload.append((const char *)&length, sizeof(length));
+    payload.append(value);
+}
+
+// Reads a value from a chunk's payload
+// Returns false if the payload is too short
+template <class T>
+bool readValue(const char *&cursor, const char *end, T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Values must be trivially copyable or strings");
+
+    if ((size_t)(end - cursor) < sizeof(value))
+        return false;
+
+    memcpy((void *)&value, cursor, sizeof(value));
+    cursor += sizeof(value);
+
+    return true;
+}
+
+// Reads a length prefixed string from a chunk's payload
+inline bool readValue(const char *&cursor, const char *end, std::string &value)
+{
+    uint32_t length;
+
+    if (!readValue(cursor, end, length) || (size_t)(end - cursor) < length)
+        return false;
+
+    value.assign(cursor, length);
+    cursor += length;
+
+    return true;
+}
+
+// Writes records to a stream in chunks
+class ChunkWriter
+{
+    // The stream being written to
+    std::ostream &out;
+
+    // Holds the stream header's flags
+    uint32_t flags;
+
+    // Holds the records of the current chunk
+    std::string payload;
+
+    // Holds the number of records in the current chunk
+    uint32_t count;
+
+    // Holds where the current record starts in the payload
+    size_t recordStart;
+
+    // Set once a record was too big for a reader to accept
+    bool oversized;
+
+    // Writes the current chunk to the stream
+    void flush()
+    {
+        uint32_t length = payload.size();
+
+        out.write((const char *)&count, sizeof(count));
+        out.write((const char *)&length, sizeof(length));
+        out.write(payload.data(), length);
+
+        if (flags & SERIALIZE_CHECKSUM)
+        {
+            uint32_t checksum = chunkChecksum(payload.data(), length);
+            out.write((const char *)&checksum, sizeof(checksum));
+        }
+
+        payload.clear();
+        count = 0;
+        recordStart = 0;
+    }
+
+public:
+    // Constructor
+    // Writes the stream header
+    ChunkWriter(std::ostream &out, uint32_t magic, bool checksummed) : out(out)
+    {
+        flags = checksummed ? SERIALIZE_CHECKSUM : 0;
+        count = 0;
+        recordStart = 0;
+        oversized = false;
+
+        payload.reserve(SERIALIZE_CHUNK_SIZE);
+
+        out.write((const char *)&magic, sizeof(magic));
+        out.write((const char *)&flags, sizeof(flags));
+    }
+
+    // Adds a value to the current record
+    template <class T>
+    void write(const T &value)
+    {
+        writeValue(payload, value);
+    }
+
+    // Marks the end of a record
+    // and flushes the chunk once it is big enough
+    void endRecord()
+    {
+        if (payload.size() - recordStart > SERIALIZE_RECORD_SIZE)
+            oversized = true;
+
+        count++;
+        recordStart = payload.size();
+
+        if (payload.size() >= SERIALIZE_CHUNK_SIZE)
+            flush();
+    }
+
+    // Adds count records of recordSize bytes each, laid back to back
+    // in records, and flushes chunks just as endRecord() would
+    //
+    // For records of trivially copyable values, which are written as
+    // they lie in memory : a container lays a batch of them out in a
+    // buffer and adds it with a memcpy per chunk, instead of a write()
+    // per value and an endRecord() per record
+    void writeRecords(const char *records, size_t count, size_t recordSize)
+    {
+        if (recordSize > SERIALIZE_RECORD_SIZE)
+            oversized = true;
+
+        while (count)
+        {
+            // endRecord() flushes once the payload reaches the chunk size,
+            // so a chunk takes records until the one that gets it there
+            size_t fit = count;
+
+            if (payload.size() + fit * recordSize > SERIALIZE_CHUNK_SIZE)
+                fit = (SERIALIZE_CHUNK_SIZE - payload.size() + recordSize - 1) / recordSize;
+
+            payload.append(records, fit * recordSize);
+
+            this->count += fit;
+            recordStart = payload.size();
+
+            records += fit * recordSize;
+            count -= fit;
+
+            if (payload.size() >= SERIALIZE_CHUNK_SIZE)
+                flush();
+        }
+    }
+
+    // Flushes the last chunk and writes the end marker
+    // Returns false if the stream failed or a record was too big
+    bool finish()
+    {
+        if (count)
+            flush();
+
+        // An empty chunk marks the end of the stream
+        flush();
+
+        return out && !oversized;
+    }
+};
+
+// Reads records written by a ChunkWriter
+class ChunkReader
+{
+    // The stream being read from
+    std::istream &in;
+
+    // Holds the stream header's flags
+    uint32_t flags;
+
+    // Holds the current chunk
+    std::string payload;
+
+    // Point into the current chunk
+    const char *cursor;
+    const char *end;
+
+    // Holds the number of records left in the current chunk
+    uint32_t remaining;
+
+    // Set once the end marker has been read
+    bool finished;
+
+    // Set once anything didn't read or check out
+    bool failed;
+
+    // Loads the next chunk from the stream
+    bool load()
+    {
+        uint32_t length;
+
+        // The records of the last chunk didn't take up all of it
+        if (cursor != end)
+            return fail();
+
+        if (!in.read((char *)&remaining, sizeof(remaining)) ||
+            !in.read((char *)&length, sizeof(length)))
+            return fail();
+
+        // The end marker
+        if (!remaining && !length)
+        {
+            finished = true;
+            return false;
+        }
+
+        // The length is read off the stream, so check it before
+        // allocating for it
+        if (length > SERIALIZE_CHUNK_SIZE + SERIALIZE_RECORD_SIZE)
+            return fail();
+
+        payload.resize(length);
+        if (!in.read(&payload[0], length))
+            return fail();
+
+        if (flags & SERIALIZE_CHECKSUM)
+        {
+            uint32_t checksum;
+
+            if (!in.read((char *)&checksum, sizeof(checksum)) ||
+                checksum != chunkChecksum(payload.data(), length))
+                return fail();
+        }
+
+        cursor = payload.data();
+        end = cursor + length;
+
+        return true;
+    }
+
+    // Marks the stream as broken
+    bool fail()
+    {
+        failed = true;
+        return false;
+    }
+
+public:
+    // Constructor
+    // Reads and checks the stream header
+    ChunkReader(std::istream &in, uint32_t magic) : in(in)
+    {
+        uint32_t streamMagic = 0;
+
+        cursor = end = nullptr;
+        remaining = 0;
+        finished = failed = false;
+
+        if (!in.read((char *)&streamMagic, sizeof(streamMagic)) ||
+            !in.read((char *)&flags, sizeof(flags)) ||
+            streamMagic != magic)
+            fail();
+    }
+
+    // Moves to the next record
+    // Returns false at the end of the stream or if it is broken
+    bool nextRecord()
+    {
+        if (failed || finished)
+            return false;
+
+        // Load chunks until one holds a record
+        while (!remaining)
+        {
+            if (!load())
+                return false;
+        }
+
+        remaining--;
+        return true;
+    }
+
+    // Reads a value of the current record
+    template <class T>
+    bool read(T &value)
+    {
+        return readValue(cursor, end, value) || fail();
+    }
+
+    // Returns true if the whole stream was read
+    bool succeeded()
+    {
+        return finished && !failed;
+    }
+};
+
+#endif
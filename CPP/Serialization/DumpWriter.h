@@ -0,0 +1,275 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         DumpWriter.h
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Text, JSON and CSV dumps of a Table in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : Moved out of GenericHashTable.cpp, to share it
+ *                         with CompactHashTable.cpp and RcuHashTable.cpp
+ * --------------------------------------------------------------------------------
+ */
+
+#ifndef DUMP_WRITER_H
+#define DUMP_WRITER_H
+
+#include <ostream>
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+#include <charconv>
+#include <type_traits>
+
+// Holds the ways a Table can be dumped
+enum DumpFormat
+{
+    // A line per "bucket", as printTable() shows it
+    DUMP_TEXT,
+
+    // An array of {"key": ..., "value": ...} objects
+    DUMP_JSON,
+
+    // A "key,value" header, then a line per Entry
+    DUMP_CSV,
+};
+
+// Dumps are written to the stream once this many bytes are buffered
+const size_t DUMP_BUFFER_SIZE = 64 * 1024;
+
+// Writes the Entries of a Table to a stream, for debugging
+//
+// Everything goes through one buffer : strings are copied in,
+// numbers are formatted in place with to_chars, and the stream
+// only gets a write() when the buffer is full, and a single flush
+// at the end. Dumping a large Table makes no temporary strings.
+// The buffer is the caller's, so a Table that dumps again and
+// again allocates it once.
+class DumpWriter
+{
+    // The stream being written to
+    std::ostream &out;
+
+    // Holds the format being written
+    DumpFormat format;
+
+    // Points to the text not yet written to the stream
+    char *buffer;
+
+    // Holds the number of bytes in the buffer
+    size_t used;
+
+    // Holds the number of Entries written so far
+    size_t entries;
+
+    // Writes the buffer to the stream
+    void flush()
+    {
+        out.write(buffer, used);
+        used = 0;
+    }
+
+    // Makes room for length more bytes
+    void reserve(size_t length)
+    {
+        if (used + length > DUMP_BUFFER_SIZE)
+            flush();
+    }
+
+    // Adds a character
+    void put(char c)
+    {
+        reserve(1);
+        buffer[used++] = c;
+    }
+
+    // Adds text as it is
+    void text(const char *data, size_t length)
+    {
+        // Too big to be worth buffering
+        if (length > DUMP_BUFFER_SIZE)
+        {
+            flush();
+            out.write(data, length);
+            return;
+        }
+
+        reserve(length);
+        std::memcpy(buffer + used, data, length);
+        used += length;
+    }
+
+    void text(const char *data)
+    {
+        text(data, std::strlen(data));
+    }
+
+    // Adds a string, quoted and escaped as the format needs
+    void field(const std::string &value)
+    {
+        if (DUMP_TEXT == format)
+            text(value.data(), value.size());
+
+        else if (DUMP_JSON == format)
+        {
+            put('"');
+
+            for (unsigned char c : value)
+            {
+                if ('"' == c || '\\' == c)
+                {
+                    put('\\');
+                    put(c);
+                }
+                else if (c < 0x20)
+                {
+                    const char *hex = "0123456789abcdef";
+
+                    text("\\u00");
+                    put(hex[c >> 4]);
+                    put(hex[c & 15]);
+                }
+                else
+                    put(c);
+            }
+
+            put('"');
+        }
+
+        // CSV only quotes a field that holds a separator or a quote,
+        // and doubles the quotes inside it
+        else if (value.find_first_of(",\"\r\n") == std::string::npos)
+            text(value.data(), value.size());
+
+        else
+        {
+            put('"');
+
+            for (char c : value)
+            {
+                if ('"' == c)
+                    put('"');
+
+                put(c);
+            }
+
+            put('"');
+        }
+    }
+
+    // Adds a number
+    template <class T>
+    void field(const T &value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Keys and values must be numbers or strings");
+
+        if constexpr (std::is_same<T, bool>::value)
+            text(value ? "true" : "false");
+
+        // JSON has no NaN or infinity
+        else if (DUMP_JSON == format && std::is_floating_point<T>::value && !std::isfinite((double)value))
+            text("null");
+
+        // Wide enough for any integer, and the shortest
+        // round trip form of any floating point number
+        else
+        {
+            reserve(64);
+            used = std::to_chars(buffer + used, buffer + DUMP_BUFFER_SIZE, value).ptr - buffer;
+        }
+    }
+
+public:
+    // Constructor
+    // Writes what comes before the Entries, buffering them in
+    // storage (which is only allocated the first time)
+    DumpWriter(std::ostream &out, DumpFormat format, std::string &storage) : out(out)
+    {
+        this->format = format;
+
+        storage.resize(DUMP_BUFFER_SIZE);
+        buffer = &storage[0];
+        used = 0;
+        entries = 0;
+
+        if (DUMP_JSON == format)
+            text("[");
+        else if (DUMP_CSV == format)
+            text("key,value\n");
+    }
+
+    // The buffer belongs to one dump
+    DumpWriter(const DumpWriter &) = delete;
+    DumpWriter &operator=(const DumpWriter &) = delete;
+
+    // Starts the Entries of "bucket" i
+    void beginBucket(size_t i)
+    {
+        if (DUMP_TEXT == format)
+        {
+            put('[');
+            field(i);
+            text("] => ");
+        }
+    }
+
+    // Adds an Entry
+    // more says if another Entry follows in the same "bucket"
+    template <class K, class V>
+    void entry(const K &key, const V &value, bool more)
+    {
+        if (DUMP_TEXT == format)
+        {
+            put('[');
+            field(key);
+            text(" : ");
+            field(value);
+            text("] ");
+
+            if (more)
+                text(" => ");
+        }
+        else if (DUMP_JSON == format)
+        {
+            text(entries ? ",\n  {\"key\": " : "\n  {\"key\": ");
+            field(key);
+            text(", \"value\": ");
+            field(value);
+            put('}');
+        }
+        else
+        {
+            field(key);
+            put(',');
+            field(value);
+            put('\n');
+        }
+
+        entries++;
+    }
+
+    // Ends the Entries of a "bucket"
+    void endBucket()
+    {
+        if (DUMP_TEXT == format)
+            put('\n');
+    }
+
+    // Writes what comes after the Entries, and flushes the stream
+    bool finish()
+    {
+        if (DUMP_JSON == format)
+            text("\n]\n");
+
+        flush();
+        out.flush();
+
+        return (bool)out;
+    }
+};
+
+#endif
@@ -0,0 +1,1046 @@
+/*
+ * --------------------------------------------------------------------------------
+ * File :         BPlusTree.cpp
+ * Project :      CPP
+ * Author :       agent
+ *
+ *
+ * Description : Cache-conscious B+ Tree (ordered index) in C++
+ * --------------------------------------------------------------------------------
+ *
+ * Revision History :
+ * 2026-October-19	[AG] : main times bulkLoad(), get() and a scan against std::map
+ * 2026-October-19	[AG] : A moved from container is empty and usable
+ * 2026-October-19	[AG] : erase() frees emptied leaves, bulkLoad() frees the old Tree
+ * 2026-October-19	[AG] : Added copy, move, swap() and a destructor
+ * 2026-October-19	[AG] : Created
+ * --------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <map>
+#include <chrono>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Searching inside a Node
+ *
+ * A Node's keys are sorted and sit next to each other, so instead of
+ * following a pointer per key (like a List or a binary tree does) the
+ * search scans a few cache lines. For int32_t and int64_t keys the scan
+ * compares 4 (or 2) keys at a time with SSE. Key arrays are always
+ * a multiple of 8 long, so the last block never reads past them.
+ */
+
+// Returns how many of the first n keys are smaller than key
+template <class K>
+int countLess(const K *keys, int n, const K &key)
+{
+    // Binary search for any other type of key
+    int low = 0;
+    int high = n;
+
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+
+        if (keys[middle] < key)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+// Returns how many of the first n keys are not bigger than key
+template <class K>
+int countLessOrEqual(const K *keys, int n, const K &key)
+{
+    int low = 0;
+    int high = n;
+
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+
+        if (!(key < keys[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+#if defined(__SSE2__)
+// Returns the lanes of a compare that count,
+// dropping the ones past the first n keys
+inline int validLanes(int mask, int remaining, int lanes)
+{
+    return remaining < lanes ? mask & ((1 << remaining) - 1) : mask;
+}
+
+inline int countLess(const int32_t *keys, int n, const int32_t &key)
+{
+    __m128i needle = _mm_set1_epi32(key);
+    int total = 0;
+
+    for (int i = 0; i < n; i += 4)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+        int mask = validLanes(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(needle, block))), n - i, 4);
+
+        total += __builtin_popcount(mask);
+
+        // The keys are sorted, so the rest are all bigger
+        if (mask != 0xF)
+            break;
+    }
+
+    return total;
+}
+
+inline int countLessOrEqual(const int32_t *keys, int n, const int32_t &key)
+{
+    __m128i needle = _mm_set1_epi32(key);
+    int total = 0;
+
+    for (int i = 0; i < n; i += 4)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+        int bigger = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, needle)));
+        int mask = validLanes(~bigger & 0xF, n - i, 4);
+
+        total += __builtin_popcount(mask);
+
+        if (mask != 0xF)
+            break;
+    }
+
+    return total;
+}
+#endif
+
+#if defined(__SSE4_2__)
+inline int countLess(const int64_t *keys, int n, const int64_t &key)
+{
+    __m128i needle = _mm_set1_epi64x(key);
+    int total = 0;
+
+    for (int i = 0; i < n; i += 2)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+        int mask = validLanes(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(needle, block))), n - i, 2);
+
+        total += __builtin_popcount(mask);
+
+        if (mask != 0x3)
+            break;
+    }
+
+    return total;
+}
+
+inline int countLessOrEqual(const int64_t *keys, int n, const int64_t &key)
+{
+    __m128i needle = _mm_set1_epi64x(key);
+    int total = 0;
+
+    for (int i = 0; i < n; i += 2)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+        int bigger = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(block, needle)));
+        int mask = validLanes(~bigger & 0x3, n - i, 2);
+
+        total += __builtin_popcount(mask);
+
+        if (mask != 0x3)
+            break;
+    }
+
+    return total;
+}
+#endif
+
+// Holds what every Node starts with
+struct BPlusNode
+{
+    // Tells a LeafNode from an InnerNode
+    bool isLeaf;
+
+    // Holds the number of keys in the Node
+    int count;
+};
+
+// Rounds a capacity down to a multiple of 8 (and at least 8)
+constexpr int roundCapacity(long capacity)
+{
+    return capacity < 16 ? 8 : (int)(capacity & ~7L);
+}
+
+// Represents a leaf, which holds the key-value pairs
+// Leaves are linked to their neighbours, like a Double Linked List,
+// so a range scan never goes back up the Tree
+template <class K, class V, int NodeBytes>
+struct alignas(64) LeafNode : BPlusNode
+{
+    // Holds as many pairs as fit in NodeBytes
+    static constexpr int CAPACITY = roundCapacity(
+        (long)(NodeBytes - sizeof(BPlusNode) - 2 * sizeof(void *)) / (long)(sizeof(K) + sizeof(V)));
+
+    // Hold the keys, sorted, and their values
+    K keys[CAPACITY];
+    V values[CAPACITY];
+
+    // Point to the neighbouring leaves
+    LeafNode *previous;
+    LeafNode *next;
+
+    // Constructor
+    LeafNode() : keys(), values()
+    {
+        isLeaf = true;
+        count = 0;
+        previous = next = nullptr;
+    }
+};
+
+// Represents an inner Node, which routes a search to a child
+// Child i holds the keys from keys[i - 1] upto (not including) keys[i]
+template <class K, int NodeBytes>
+struct alignas(64) InnerNode : BPlusNode
+{
+    // Holds as many keys as fit in NodeBytes
+    static constexpr int CAPACITY = roundCapacity(
+        (long)(NodeBytes - sizeof(BPlusNode) - sizeof(void *)) / (long)(sizeof(K) + sizeof(void *)));
+
+    // Holds the separator keys, sorted
+    K keys[CAPACITY];
+
+    // Points to the children, one more than the keys
+    BPlusNode *children[CAPACITY + 1];
+
+    // Constructor
+    InnerNode() : keys()
+    {
+        isLeaf = false;
+        count = 0;
+
+        for (int i = 0; i <= CAPACITY; i++)
+            children[i] = nullptr;
+    }
+};
+
+// Represents a B+ Tree
+//
+// Each Node takes about NodeBytes (a few cache lines by default,
+// or a page) so a lookup touches one small block per level, and a
+// Tree of 1e8 keys is only 4 or 5 levels deep
+template <class K, class V, int NodeBytes = 512>
+class BPlusTree
+{
+    typedef LeafNode<K, V, NodeBytes> Leaf;
+    typedef InnerNode<K, NodeBytes> Inner;
+
+    // Points to the root Node
+    BPlusNode *root;
+
+    // Point to the first and last leaves
+    Leaf *firstLeaf;
+    Leaf *lastLeaf;
+
+    // Holds the number of key-value pairs
+    size_t count;
+
+    // Returns the leaf a key belongs in
+    Leaf *findLeaf(const K &key)
+    {
+        BPlusNode *node = root;
+
+        while (!node->isLeaf)
+        {
+            Inner *inner = (Inner *)node;
+            node = inner->children[countLessOrEqual(inner->keys, inner->count, key)];
+        }
+
+        return (Leaf *)node;
+    }
+
+    // Adds a pair to a leaf, splitting it if it is full
+    // Returns false if the key was already there (its value is replaced)
+    bool insertIntoLeaf(Leaf *leaf, const K &key, const V &value, K &splitKey, BPlusNode *&splitNode)
+    {
+        int position = countLess(leaf->keys, leaf->count, key);
+
+        // Key found, replace its value
+        if (position < leaf->count && !(key < leaf->keys[position]))
+        {
+            leaf->values[position] = value;
+            return false;
+        }
+
+        // The leaf is full, move its upper half to a new leaf
+        if (leaf->count == Leaf::CAPACITY)
+        {
+            Leaf *right = new Leaf();
+            int half = Leaf::CAPACITY / 2;
+
+            for (int i = half; i < leaf->count; i++)
+            {
+                right->keys[i - half] = leaf->keys[i];
+                right->values[i - half] = leaf->values[i];
+            }
+
+            right->count = leaf->count - half;
+            leaf->count = half;
+
+            // Link the new leaf in after the old one
+            right->previous = leaf;
+            right->next = leaf->next;
+
+            if (leaf->next)
+                leaf->next->previous = right;
+            else
+                lastLeaf = right;
+
+            leaf->next = right;
+
+            splitKey = right->keys[0];
+            splitNode = right;
+
+            // Continue with whichever half the key belongs in
+            if (position > half)
+            {
+                position -= half;
+                leaf = right;
+            }
+        }
+
+        // Shift the bigger keys up by one
+        for (int i = leaf->count; i > position; i--)
+        {
+            leaf->keys[i] = leaf->keys[i - 1];
+            leaf->values[i] = leaf->values[i - 1];
+        }
+
+        leaf->keys[position] = key;
+        leaf->values[position] = value;
+        leaf->count++;
+
+        return true;
+    }
+
+    // Adds a separator and the child after it to an inner Node,
+    // splitting the Node if it is full
+    void insertIntoInner(Inner *inner, int position, const K &key, BPlusNode *child, K &splitKey, BPlusNode *&splitNode)
+    {
+        // Room left, shift the bigger keys and their children up by one
+        if (inner->count < Inner::CAPACITY)
+        {
+            for (int i = inner->count; i > position; i--)
+            {
+                inner->keys[i] = inner->keys[i - 1];
+                inner->children[i + 1] = inner->children[i];
+            }
+
+            inner->keys[position] = key;
+            inner->children[position + 1] = child;
+            inner->count++;
+
+            return;
+        }
+
+        // The Node is full
+        // Lay every key and child out in order, then split them
+        K keys[Inner::CAPACITY + 1];
+        BPlusNode *children[Inner::CAPACITY + 2];
+
+        for (int i = 0, j = 0; i <= Inner::CAPACITY; i++)
+            keys[i] = (i == position) ? key : inner->keys[j++];
+
+        for (int i = 0, j = 0; i <= Inner::CAPACITY + 1; i++)
+            children[i] = (i == position + 1) ? child : inner->children[j++];
+
+        // The middle key moves up to the parent
+        int half = (Inner::CAPACITY + 1) / 2;
+        Inner *right = new Inner();
+
+        inner->count = half;
+
+        for (int i = 0; i < half; i++)
+        {
+            inner->keys[i] = keys[i];
+            inner->children[i] = children[i];
+        }
+
+        inner->children[half] = children[half];
+
+        right->count = Inner::CAPACITY - half;
+
+        for (int i = 0; i < right->count; i++)
+        {
+            right->keys[i] = keys[half + 1 + i];
+            right->children[i] = children[half + 1 + i];
+        }
+
+        right->children[right->count] = children[Inner::CAPACITY + 1];
+
+        for (int i = inner->count + 1; i <= Inner::CAPACITY; i++)
+            inner->children[i] = nullptr;
+
+        splitKey = keys[half];
+        splitNode = right;
+    }
+
+    // Adds a pair below a Node
+    // If the Node splits, splitNode is its new right sibling
+    // and splitKey is the smallest key below it
+    bool insertBelow(BPlusNode *node, const K &key, const V &value, K &splitKey, BPlusNode *&splitNode)
+    {
+        if (node->isLeaf)
+            return insertIntoLeaf((Leaf *)node, key, value, splitKey, splitNode);
+
+        Inner *inner = (Inner *)node;
+        int position = countLessOrEqual(inner->keys, inner->count, key);
+
+        K childSplitKey = K();
+        BPlusNode *childSplitNode = nullptr;
+
+        bool added = insertBelow(inner->children[position], key, value, childSplitKey, childSplitNode);
+
+        // The child split, add its new sibling after it
+        if (childSplitNode)
+            insertIntoInner(inner, position, childSplitKey, childSplitNode, splitKey, splitNode);
+
+        return added;
+    }
+
+    // Deletes a Node and everything below it
+    void deleteBelow(BPlusNode *node)
+    {
+        if (!node->isLeaf)
+        {
+            Inner *inner = (Inner *)node;
+
+            for (int i = 0; i <= inner->count; i++)
+                deleteBelow(inner->children[i]);
+
+            delete inner;
+        }
+        else
+            delete (Leaf *)node;
+    }
+
+    // Removes a key below a Node
+    // Returns false if the key is not there; emptied is set when the
+    // Node is left with no pairs (a leaf) or no children (an inner Node)
+    // and must be dropped by its parent
+    bool eraseBelow(BPlusNode *node, const K &key, bool &emptied)
+    {
+        if (node->isLeaf)
+        {
+            Leaf *leaf = (Leaf *)node;
+            int position = countLess(leaf->keys, leaf->count, key);
+
+            // No such key in the Tree
+            if (position == leaf->count || key < leaf->keys[position])
+                return false;
+
+            // Shift the bigger keys down by one
+            for (int i = position + 1; i < leaf->count; i++)
+            {
+                leaf->keys[i - 1] = leaf->keys[i];
+                leaf->values[i - 1] = leaf->values[i];
+            }
+
+            leaf->count--;
+            emptied = leaf->count == 0;
+
+            return true;
+        }
+
+        Inner *inner = (Inner *)node;
+        int position = countLessOrEqual(inner->keys, inner->count, key);
+        bool childEmptied = false;
+
+        if (!eraseBelow(inner->children[position], key, childEmptied))
+            return false;
+
+        if (!childEmptied)
+            return true;
+
+        dropNode(inner->children[position]);
+
+        // That was the only child, so this Node goes too
+        if (inner->count == 0)
+        {
+            inner->children[0] = nullptr;
+            emptied = true;
+
+            return true;
+        }
+
+        // Remove the child and a separator next to it
+        // Its neighbour takes over the range of keys it routed
+        for (int i = position > 0 ? position - 1 : 0; i < inner->count - 1; i++)
+            inner->keys[i] = inner->keys[i + 1];
+
+        for (int i = position; i < inner->count; i++)
+            inner->children[i] = inner->children[i + 1];
+
+        inner->children[inner->count] = nullptr;
+        inner->count--;
+
+        return true;
+    }
+
+    // Frees a Node emptied by eraseBelow()
+    // A leaf is unlinked from its neighbours first
+    void dropNode(BPlusNode *node)
+    {
+        if (!node->isLeaf)
+        {
+            delete (Inner *)node;
+            return;
+        }
+
+        Leaf *leaf = (Leaf *)node;
+
+        if (leaf->previous)
+            leaf->previous->next = leaf->next;
+        else
+            firstLeaf = leaf->next;
+
+        if (leaf->next)
+            leaf->next->previous = leaf->previous;
+        else
+            lastLeaf = leaf->previous;
+
+        delete leaf;
+    }
+
+    // Builds one level of inner Nodes over the Nodes below
+    // smallest[i] is the smallest key below nodes[i]
+    void buildLevel(vector<BPlusNode *> &nodes, vector<K> &smallest)
+    {
+        // Spread the children evenly, so no Node is left nearly empty
+        size_t parents = (nodes.size() + Inner::CAPACITY) / (Inner::CAPACITY + 1);
+        size_t perParent = nodes.size() / parents;
+        size_t extra = nodes.size() % parents;
+
+        vector<BPlusNode *> parentNodes;
+        vector<K> parentSmallest;
+
+        for (size_t p = 0, next = 0; p < parents; p++)
+        {
+            Inner *inner = new Inner();
+            size_t children = perParent + (p < extra ? 1 : 0);
+
+            parentNodes.push_back(inner);
+            parentSmallest.push_back(smallest[next]);
+
+            for (size_t i = 0; i < children; i++, next++)
+            {
+                inner->children[i] = nodes[next];
+
+                if (i)
+                    inner->keys[i - 1] = smallest[next];
+            }
+
+            inner->count = children - 1;
+        }
+
+        nodes.swap(parentNodes);
+        smallest.swap(parentSmallest);
+    }
+
+public:
+    // Points at a pair of the Tree, or past the last one
+    class Iterator
+    {
+        // Points to the leaf, nullptr past the last pair
+        Leaf *leaf;
+
+        // Holds the position in the leaf
+        int index;
+
+    public:
+        // Constructor
+        // Moves on to the next leaf if index is past this one
+        Iterator(Leaf *leaf, int index)
+        {
+            this->leaf = leaf;
+            this->index = index;
+
+            while (this->leaf && this->index >= this->leaf->count)
+            {
+                this->leaf = this->leaf->next;
+                this->index = 0;
+            }
+        }
+
+        const K &key()
+        {
+            return leaf->keys[index];
+        }
+
+        V &value()
+        {
+            return leaf->values[index];
+        }
+
+        // Moves to the next pair, following the sibling link
+        // at the end of a leaf
+        Iterator &operator++()
+        {
+            if (++index >= leaf->count)
+                *this = Iterator(leaf->next, 0);
+
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return leaf == other.leaf && (!leaf || index == other.index);
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    // Constructor
+    BPlusTree()
+    {
+        // An empty Tree is a single empty leaf
+        firstLeaf = lastLeaf = new Leaf();
+        root = firstLeaf;
+        count = 0;
+    }
+
+    // Copy Constructor
+    // The pairs are read off the leaves in order and bulk loaded,
+    // so the copy is packed as tightly as bulkLoad() packs them
+    BPlusTree(const BPlusTree &other) : BPlusTree()
+    {
+        vector<K> keys;
+        vector<V> values;
+
+        keys.reserve(other.count);
+        values.reserve(other.count);
+
+        for (Leaf *leaf = other.firstLeaf; leaf; leaf = leaf->next)
+        {
+            for (int i = 0; i < leaf->count; i++)
+            {
+                keys.push_back(leaf->keys[i]);
+                values.push_back(leaf->values[i]);
+            }
+        }
+
+        bulkLoad(keys.data(), values.data(), keys.size());
+    }
+
+    // Move Constructor
+    // Takes other's Nodes in O(1)
+    // other is left empty, without even a leaf until its next insert()
+    BPlusTree(BPlusTree &&other) noexcept
+    {
+        root = other.root;
+        firstLeaf = other.firstLeaf;
+        lastLeaf = other.lastLeaf;
+        count = other.count;
+
+        other.root = other.firstLeaf = other.lastLeaf = nullptr;
+        other.count = 0;
+    }
+
+    // Copy and Move Assignment
+    // other is already a copy (or the Tree moved from),
+    // so its Nodes are taken and ours go away with it
+    BPlusTree &operator=(BPlusTree other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor
+    ~BPlusTree()
+    {
+        if (root)
+            deleteBelow(root);
+    }
+
+    // Trades Nodes with another Tree
+    void swap(BPlusTree &other) noexcept
+    {
+        std::swap(root, other.root);
+        std::swap(firstLeaf, other.firstLeaf);
+        std::swap(lastLeaf, other.lastLeaf);
+        std::swap(count, other.count);
+    }
+
+    // Adds a key-value pair to the Tree
+    // Returns false if the key was already there, and replaces its value
+    bool insert(K key, V value)
+    {
+        // A moved from Tree needs a leaf again
+        if (!root)
+            firstLeaf = lastLeaf = (Leaf *)(root = new Leaf());
+
+        K splitKey = K();
+        BPlusNode *splitNode = nullptr;
+
+        bool added = insertBelow(root, key, value, splitKey, splitNode);
+
+        // The root split, grow the Tree by a level
+        if (splitNode)
+        {
+            Inner *newRoot = new Inner();
+
+            newRoot->keys[0] = splitKey;
+            newRoot->children[0] = root;
+            newRoot->children[1] = splitNode;
+            newRoot->count = 1;
+
+            root = newRoot;
+        }
+
+        if (added)
+            count++;
+
+        return added;
+    }
+
+    // Gets the value of a key from the Tree
+    bool get(K key, V &value)
+    {
+        // A moved from Tree has no Nodes
+        if (!root)
+            return false;
+
+        Leaf *leaf = findLeaf(key);
+        int position = countLess(leaf->keys, leaf->count, key);
+
+        // Key found
+        if (position < leaf->count && !(key < leaf->keys[position]))
+        {
+            value = leaf->values[position];
+            return true;
+        }
+
+        // No such key in the Tree
+        return false;
+    }
+
+    // Returns an Iterator to the first pair whose key is not before key
+    Iterator lowerBound(K key)
+    {
+        // A moved from Tree has no Nodes
+        if (!root)
+            return end();
+
+        Leaf *leaf = findLeaf(key);
+
+        return Iterator(leaf, countLess(leaf->keys, leaf->count, key));
+    }
+
+    // Returns an Iterator to the first pair
+    Iterator begin()
+    {
+        return Iterator(firstLeaf, 0);
+    }
+
+    // Returns an Iterator past the last pair
+    Iterator end()
+    {
+        return Iterator(nullptr, 0);
+    }
+
+    // Removes a key-value pair from the Tree
+    //
+    // Leaves are not merged when they get emptier, which keeps erase()
+    // cheap; the separators above still route every search correctly.
+    // A leaf that is emptied is unlinked and freed, and so is an inner
+    // Node left without children, and the root drops a level while it
+    // has a single child
+    bool erase(K key)
+    {
+        bool emptied = false;
+
+        if (!root || !eraseBelow(root, key, emptied))
+            return false;
+
+        count--;
+
+        // Every leaf below the root inner Node is gone
+        if (emptied && !root->isLeaf)
+        {
+            delete (Inner *)root;
+
+            firstLeaf = lastLeaf = new Leaf();
+            root = firstLeaf;
+        }
+
+        // Shrink the Tree while the root routes to a single child
+        while (!root->isLeaf && root->count == 0)
+        {
+            Inner *inner = (Inner *)root;
+
+            root = inner->children[0];
+            delete inner;
+        }
+
+        return true;
+    }
+
+    // Builds the Tree from n pairs sorted by key, bottom up, filling
+    // each leaf completely instead of splitting its way there
+    // Returns false if the Tree is not empty or the keys are not sorted
+    bool bulkLoad(const K *keys, const V *values, size_t n)
+    {
+        if (count)
+            return false;
+
+        for (size_t i = 1; i < n; i++)
+        {
+            if (!(keys[i - 1] < keys[i]))
+                return false;
+        }
+
+        if (!n)
+            return true;
+
+        // The Tree may still have Nodes left from before it was emptied
+        if (root)
+            deleteBelow(root);
+
+        // Spread the pairs evenly over as few leaves as possible
+        size_t leaves = (n + Leaf::CAPACITY - 1) / Leaf::CAPACITY;
+        size_t perLeaf = n / leaves;
+        size_t extra = n % leaves;
+
+        vector<BPlusNode *> nodes;
+        vector<K> smallest;
+
+        Leaf *previous = nullptr;
+
+        for (size_t l = 0, next = 0; l < leaves; l++)
+        {
+            Leaf *leaf = new Leaf();
+
+            leaf->count = perLeaf + (l < extra ? 1 : 0);
+
+            for (int i = 0; i < leaf->count; i++, next++)
+            {
+                leaf->keys[i] = keys[next];
+                leaf->values[i] = values[next];
+            }
+
+            // Link the leaves to their neighbours
+            leaf->previous = previous;
+
+            if (previous)
+                previous->next = leaf;
+            else
+                firstLeaf = leaf;
+
+            previous = leaf;
+
+            nodes.push_back(leaf);
+            smallest.push_back(leaf->keys[0]);
+        }
+
+        lastLeaf = previous;
+
+        // Build the inner levels until a single root is left
+        while (nodes.size() > 1)
+            buildLevel(nodes, smallest);
+
+        root = nodes[0];
+        count = n;
+
+        return true;
+    }
+
+    // Returns the number of key-value pairs
+    size_t size()
+    {
+        return count;
+    }
+
+    // Prints the Tree in key order
+    void printForward()
+    {
+        for (Iterator current = begin(); current != end(); ++current)
+            cout << "[" << current.key() << " : " << current.value() << "] ";
+
+        cout << endl;
+    }
+
+    // Clears the entire Tree
+    size_t clear()
+    {
+        size_t counter = count;
+
+        if (root)
+            deleteBelow(root);
+
+        firstLeaf = lastLeaf = new Leaf();
+        root = firstLeaf;
+        count = 0;
+
+        return counter;
+    }
+};
+
+// Times loading n sorted keys, n point lookups in a scattered
+// order and a scan of every pair, against a std::map
+void treeAgainstMap(int64_t n)
+{
+    vector<int64_t> keys;
+    vector<int64_t> values;
+
+    for (int64_t i = 0; i < n; i++)
+    {
+        keys.push_back(i * 2);
+        values.push_back(i);
+    }
+
+    // Looks keys up all over the Tree, not one leaf after another
+    vector<int64_t> lookups;
+    for (int64_t i = 0; i < n; i++)
+        lookups.push_back((uint64_t(i) * 2654435761u % uint64_t(n)) * 2);
+
+    int64_t treeSum = 0, mapSum = 0;
+
+    auto start = chrono::steady_clock::now();
+
+    BPlusTree<int64_t, int64_t> tree;
+    tree.bulkLoad(keys.data(), values.data(), keys.size());
+
+    auto treeLoad = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (auto key : lookups)
+    {
+        int64_t value;
+        if (tree.get(key, value))
+            treeSum += value;
+    }
+
+    auto treeGet = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (auto current = tree.begin(); current != tree.end(); ++current)
+        treeSum += current.value();
+
+    auto treeScan = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    // A std::map is given the same sorted keys, with the end as hint
+    map<int64_t, int64_t> ordered;
+    for (int64_t i = 0; i < n; i++)
+        ordered.emplace_hint(ordered.end(), keys[i], values[i]);
+
+    auto mapLoad = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (auto key : lookups)
+    {
+        auto found = ordered.find(key);
+        if (found != ordered.end())
+            mapSum += found->second;
+    }
+
+    auto mapGet = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    for (auto &pair : ordered)
+        mapSum += pair.second;
+
+    auto mapScan = chrono::steady_clock::now() - start;
+
+    auto us = [](chrono::steady_clock::duration duration)
+    {
+        return chrono::duration_cast<chrono::microseconds>(duration).count();
+    };
+
+    cout << n << " keys" << endl;
+    cout << "bulkLoad() : " << us(treeLoad) << " us, std::map : " << us(mapLoad) << " us" << endl;
+    cout << "get() : " << us(treeGet) << " us, std::map : " << us(mapGet) << " us" << endl;
+    cout << "Scan : " << us(treeScan) << " us, std::map : " << us(mapScan) << " us"
+         << " (" << (treeSum == mapSum ? "same sums" : "different sums") << ")" << endl;
+}
+
+int main()
+{
+    // Create a new B+ Tree
+    BPlusTree<int32_t, string> tree;
+
+    tree.insert(30, "Stepanov");
+    tree.insert(10, "Dennis");
+    tree.insert(50, "Knuth");
+    tree.insert(20, "Bjarne");
+    tree.insert(40, "Dijkstra");
+
+    tree.printForward();
+
+    string result;
+    if (tree.get(20, result))
+        cout << result << endl;
+
+    tree.erase(30);
+    tree.printForward();
+
+    // Trees can be copied and moved around by value
+    BPlusTree<int32_t, string> copy(tree);
+    BPlusTree<int32_t, string> moved(std::move(tree));
+
+    copy.insert(60, "Hoare");
+    copy.printForward();
+
+    tree = moved;
+    cout << moved.clear() << endl;
+
+    // Bulk load a million sorted keys, then scan a range
+    BPlusTree<int64_t, int64_t> squares;
+
+    vector<int64_t> keys;
+    vector<int64_t> values;
+
+    for (int64_t i = 0; i < 1000000; i++)
+    {
+        keys.push_back(i * 2);
+        values.push_back(i * i);
+    }
+
+    squares.bulkLoad(keys.data(), values.data(), keys.size());
+
+    // Print every key from 999 upto (not including) 1010
+    for (auto current = squares.lowerBound(999); current != squares.end() && current.key() < 1010; ++current)
+        cout << current.key() << " ";
+    cout << endl;
+
+    cout << squares.clear() << endl;
+
+    // Loads, lookups and a full scan against std::map
+    treeAgainstMap(1000000);
+
+    return 0;
+}